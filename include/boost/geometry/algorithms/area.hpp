@@ -101,20 +101,12 @@ struct ring_area
             <
                 rview_type const, Closure
             >::type view_type;
-        typedef typename boost::range_iterator<view_type const>::type iterator_type;
 
         rview_type rview(ring);
         view_type view(rview);
         typename Strategy::state_type state;
-        iterator_type it = boost::begin(view);
-        iterator_type end = boost::end(view);
-
-        for (iterator_type previous = it++;
-            it != end;
-            ++previous, ++it)
-        {
-            strategy.apply(*previous, *it, state);
-        }
+        strategy::area::services::apply_range<Strategy>::apply(strategy,
+                boost::begin(view), boost::end(view), state);
 
         return strategy.result(state);
     }
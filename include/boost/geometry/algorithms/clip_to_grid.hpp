@@ -0,0 +1,637 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/views/closeable_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Regular grid of cells, for example tiles, used by clip_to_grid
+\ingroup clip_to_grid
+\tparam Point point type of the origin
+*/
+template <typename Point>
+class regular_grid
+{
+public :
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+
+    /*!
+    \brief Constructs the grid
+    \param origin lower left corner of the cell at column 0, row 0
+    \param cell_width width of all cells
+    \param cell_height height of all cells
+    \param columns number of columns
+    \param rows number of rows
+    */
+    inline regular_grid(Point const& origin,
+                coordinate_type const& cell_width,
+                coordinate_type const& cell_height,
+                std::size_t columns, std::size_t rows)
+        : m_origin(origin)
+        , m_columns(columns)
+        , m_rows(rows)
+    {
+        m_cell_size[0] = cell_width;
+        m_cell_size[1] = cell_height;
+    }
+
+    inline std::size_t columns() const { return m_columns; }
+    inline std::size_t rows() const { return m_rows; }
+
+    //! Returns the number of cells in the specified dimension
+    template <std::size_t Dimension>
+    inline std::size_t count() const
+    {
+        return Dimension == 0 ? m_columns : m_rows;
+    }
+
+    //! Returns the coordinate of the border before the cell with the index
+    template <std::size_t Dimension>
+    inline coordinate_type border(std::size_t index) const
+    {
+        return geometry::get<Dimension>(m_origin)
+            + coordinate_type(index) * m_cell_size[Dimension];
+    }
+
+    //! Returns the (possibly negative) index of the cell containing the value
+    template <std::size_t Dimension, typename T>
+    inline long index_of(T const& value) const
+    {
+        return static_cast<long>(std::floor(
+            (value - geometry::get<Dimension>(m_origin))
+                / m_cell_size[Dimension]));
+    }
+
+    //! Assigns the box of a cell
+    template <typename Box>
+    inline void cell(std::size_t column, std::size_t row, Box& box) const
+    {
+        geometry::assign_values(box,
+            border<0>(column), border<1>(row),
+            border<0>(column + 1), border<1>(row + 1));
+    }
+
+private :
+    Point m_origin;
+    coordinate_type m_cell_size[2];
+    std::size_t m_columns;
+    std::size_t m_rows;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace clip_to_grid
+{
+
+
+/*!
+\brief Distributes a range of points over the columns (Dimension 0) or
+    rows (Dimension 1) of a grid
+\details Each segment is visited once, and only clipped by the cells it
+    spans. Per cell this gives the same result as clipping by that cell
+    only: Liang-Barsky for linear ranges, Sutherland-Hodgman for (open,
+    Cyclic) rings. Points on the borders get exactly the border coordinate,
+    and are equal in the neighbouring cells.
+*/
+template <std::size_t Dimension, bool Cyclic>
+struct distribute
+{
+    template <typename Points, typename Grid, typename Pieces>
+    static inline void apply(Points const& points, Grid const& grid,
+                Pieces& pieces)
+    {
+        typedef typename boost::range_value<Points>::type point_type;
+        typedef typename Grid::coordinate_type coordinate_type;
+
+        std::size_t const n = boost::size(points);
+        if (n < 2)
+        {
+            return;
+        }
+
+        long const count = static_cast<long>(grid.template count<Dimension>());
+        std::size_t const segment_count = Cyclic ? n : n - 1;
+        for (std::size_t i = 0; i < segment_count; i++)
+        {
+            point_type const& p = range::at(points, i);
+            point_type const& q = range::at(points, (i + 1) % n);
+            coordinate_type const pd = geometry::get<Dimension>(p);
+            coordinate_type const qd = geometry::get<Dimension>(q);
+
+            // Take one cell extra at both sides, to be sure that cells
+            // touched by segments ending at the border are included
+            long first = grid.template index_of<Dimension>((std::min)(pd, qd)) - 1;
+            long last = grid.template index_of<Dimension>((std::max)(pd, qd)) + 1;
+            first = (std::max)(first, 0L);
+            last = (std::min)(last, count - 1);
+
+            for (long c = first; c <= last; c++)
+            {
+                coordinate_type const low = grid.template border<Dimension>(c);
+                coordinate_type const high = grid.template border<Dimension>(c + 1);
+                if ((pd < low && qd < low) || (pd > high && qd > high))
+                {
+                    continue;
+                }
+
+                bool const start_clipped = pd < low || pd > high;
+                bool const end_clipped = qd < low || qd > high;
+
+                typename Pieces::mapped_type& list = pieces[c];
+                if (list.empty()
+                    || (! Cyclic && start_clipped)
+                    || (! Cyclic
+                        && ! detail::equals::equals_point_point(
+                                    range::back(list.back()), p)))
+                {
+                    list.resize(list.size() + 1);
+                    if (! start_clipped && ! Cyclic)
+                    {
+                        list.back().push_back(p);
+                    }
+                }
+
+                if (start_clipped)
+                {
+                    point_type ip;
+                    detail::intersection::segment_point_at<Dimension>(p, q,
+                        pd < low ? low : high, ip);
+                    list.back().push_back(ip);
+                }
+                if (end_clipped)
+                {
+                    point_type ip;
+                    detail::intersection::segment_point_at<Dimension>(p, q,
+                        qd < low ? low : high, ip);
+                    list.back().push_back(ip);
+                }
+                else
+                {
+                    list.back().push_back(q);
+                }
+            }
+        }
+    }
+};
+
+
+template <typename Point>
+struct types
+{
+    typedef std::vector<Point> points_type;
+    typedef std::map<long, std::vector<points_type> > pieces_type;
+};
+
+
+template <typename LinestringOut>
+struct clip_linear
+{
+    typedef typename point_type<LinestringOut>::type point_type;
+    typedef typename types<point_type>::points_type points_type;
+    typedef typename types<point_type>::pieces_type pieces_type;
+
+    template <typename Linestring, typename Grid, typename Visitor>
+    static inline void apply(Linestring const& linestring, Grid const& grid,
+                Visitor& visitor)
+    {
+        points_type points;
+        for (typename boost::range_iterator<Linestring const>::type
+                it = boost::begin(linestring);
+             it != boost::end(linestring);
+             ++it)
+        {
+            point_type p;
+            geometry::convert(*it, p);
+            points.push_back(p);
+        }
+
+        pieces_type columns;
+        distribute<0, false>::apply(points, grid, columns);
+
+        for (typename pieces_type::iterator cit = columns.begin();
+             cit != columns.end(); ++cit)
+        {
+            for (std::size_t i = 0; i < cit->second.size(); i++)
+            {
+                pieces_type rows;
+                distribute<1, false>::apply(cit->second[i], grid, rows);
+
+                for (typename pieces_type::iterator rit = rows.begin();
+                     rit != rows.end(); ++rit)
+                {
+                    visit(cit->first, rit->first, rit->second, visitor);
+                }
+            }
+        }
+    }
+
+private :
+    template <typename Visitor>
+    static inline void visit(long column, long row,
+                std::vector<points_type>& pieces, Visitor& visitor)
+    {
+        for (std::size_t i = 0; i < pieces.size(); i++)
+        {
+            detail::intersection::remove_consecutive_duplicates(pieces[i]);
+            if (pieces[i].size() < 2)
+            {
+                continue;
+            }
+            LinestringOut line;
+            for (std::size_t j = 0; j < pieces[i].size(); j++)
+            {
+                geometry::append(line, pieces[i][j]);
+            }
+            visitor.apply(std::size_t(column), std::size_t(row), line);
+        }
+    }
+};
+
+
+template <typename PolygonOut>
+struct clip_areal
+{
+    typedef typename point_type<PolygonOut>::type point_type;
+    typedef typename ring_type<PolygonOut>::type ring_type;
+    typedef typename types<point_type>::points_type points_type;
+    typedef typename types<point_type>::pieces_type pieces_type;
+    typedef model::box<point_type> box_type;
+
+    // Clipped interior rings of one cell
+    struct cell_interiors
+    {
+        cell_interiors()
+            : fallback(false)
+        {}
+
+        std::vector<points_type> rings;
+        bool fallback;
+    };
+
+    template <typename Polygon, typename Grid, typename Visitor>
+    static inline void apply(Polygon const& polygon, Grid const& grid,
+                Visitor& visitor)
+    {
+        static bool const reverse = geometry::point_order<Polygon>::value
+                    != geometry::point_order<PolygonOut>::value;
+
+        std::map<std::size_t, points_type> exteriors;
+        std::map<std::size_t, cell_interiors> interiors;
+
+        distribute_ring(exterior(polygon, typename tag<Polygon>::type()),
+                grid, exteriors);
+        add_interiors(polygon, grid, interiors, typename tag<Polygon>::type());
+
+        for (typename std::map<std::size_t, points_type>::iterator
+                it = exteriors.begin(); it != exteriors.end(); ++it)
+        {
+            std::size_t const column = it->first % grid.columns();
+            std::size_t const row = it->first / grid.columns();
+            box_type box;
+            grid.cell(column, row, box);
+
+            points_type& points = it->second;
+            detail::intersection::remove_cyclic_duplicates(points);
+            if (! detail::intersection::has_area(points))
+            {
+                continue;
+            }
+
+            typename std::map<std::size_t, cell_interiors>::iterator
+                    iit = interiors.find(it->first);
+            bool const fallback = iit != interiors.end() && iit->second.fallback;
+
+            if (fallback
+                || detail::intersection::has_overlapping_border_segments(box, points))
+            {
+                // The clipped polygon would not be valid, use the general
+                // intersection (for this cell only)
+                std::vector<PolygonOut> parts;
+                geometry::intersection(polygon, box, parts);
+                for (std::size_t i = 0; i < parts.size(); i++)
+                {
+                    visitor.apply(column, row, parts[i]);
+                }
+                continue;
+            }
+
+            PolygonOut result;
+            assign_ring(points, reverse, exterior_ring(result));
+            if (iit != interiors.end())
+            {
+                for (std::size_t i = 0; i < iit->second.rings.size(); i++)
+                {
+                    interior_rings(result).resize(interior_rings(result).size() + 1);
+                    assign_ring(iit->second.rings[i], reverse,
+                        range::back(interior_rings(result)));
+                }
+            }
+            visitor.apply(column, row, result);
+        }
+    }
+
+private :
+    static inline void assign_ring(points_type& points, bool reverse,
+                ring_type& ring)
+    {
+        if (reverse)
+        {
+            std::reverse(points.begin(), points.end());
+        }
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            range::push_back(ring, points[i]);
+        }
+        if (geometry::closure<ring_type>::value == closed)
+        {
+            range::push_back(ring, points.front());
+        }
+    }
+
+    // Clips a ring by all cells it covers, the results are keyed by cell
+    template <typename Ring, typename Grid>
+    static inline void distribute_ring(Ring const& ring, Grid const& grid,
+                std::map<std::size_t, points_type>& result)
+    {
+        typedef typename closeable_view
+            <
+                Ring const, geometry::closure<Ring>::value
+            >::type view_type;
+
+        view_type view(ring);
+        points_type points;
+        for (typename boost::range_iterator<view_type const>::type
+                it = boost::begin(view);
+             it != boost::end(view);
+             ++it)
+        {
+            point_type p;
+            geometry::convert(*it, p);
+            points.push_back(p);
+        }
+        if (! points.empty())
+        {
+            // Make it open, the closing segment is handled as cyclic
+            points.pop_back();
+        }
+
+        pieces_type columns;
+        distribute<0, true>::apply(points, grid, columns);
+        for (typename pieces_type::iterator cit = columns.begin();
+             cit != columns.end(); ++cit)
+        {
+            pieces_type rows;
+            distribute<1, true>::apply(cit->second.front(), grid, rows);
+            for (typename pieces_type::iterator rit = rows.begin();
+                 rit != rows.end(); ++rit)
+            {
+                std::size_t const index
+                    = std::size_t(rit->first) * grid.columns() + cit->first;
+                result[index].swap(rit->second.front());
+            }
+        }
+    }
+
+    template <typename Ring>
+    static inline Ring const& exterior(Ring const& ring, ring_tag)
+    {
+        return ring;
+    }
+
+    template <typename Polygon>
+    static inline typename geometry::ring_type<Polygon>::type const&
+    exterior(Polygon const& polygon, polygon_tag)
+    {
+        return exterior_ring(polygon);
+    }
+
+    template <typename Ring, typename Grid>
+    static inline void add_interiors(Ring const& , Grid const& ,
+                std::map<std::size_t, cell_interiors>& , ring_tag)
+    {}
+
+    template <typename Polygon, typename Grid>
+    static inline void add_interiors(Polygon const& polygon, Grid const& grid,
+                std::map<std::size_t, cell_interiors>& interiors, polygon_tag)
+    {
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings);
+             it != boost::end(rings);
+             ++it)
+        {
+            std::map<std::size_t, points_type> cells;
+            distribute_ring(*it, grid, cells);
+
+            for (typename std::map<std::size_t, points_type>::iterator
+                    cit = cells.begin(); cit != cells.end(); ++cit)
+            {
+                points_type& points = cit->second;
+                detail::intersection::remove_cyclic_duplicates(points);
+                if (! detail::intersection::has_area(points))
+                {
+                    continue;
+                }
+
+                box_type box;
+                grid.cell(cit->first % grid.columns(),
+                          cit->first / grid.columns(), box);
+
+                cell_interiors& target = interiors[cit->first];
+                if (on_border(box, points))
+                {
+                    // Interior rings crossing a cell border
+                    // are handled by the general intersection
+                    target.fallback = true;
+                }
+                else
+                {
+                    target.rings.push_back(points_type());
+                    target.rings.back().swap(points);
+                }
+            }
+        }
+    }
+
+    static inline bool on_border(box_type const& box, points_type const& points)
+    {
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            if (geometry::get<0>(points[i]) == geometry::get<min_corner, 0>(box)
+                || geometry::get<0>(points[i]) == geometry::get<max_corner, 0>(box)
+                || geometry::get<1>(points[i]) == geometry::get<min_corner, 1>(box)
+                || geometry::get<1>(points[i]) == geometry::get<max_corner, 1>(box))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+
+template <typename Policy>
+struct clip_multi
+{
+    template <typename Multi, typename Grid, typename Visitor>
+    static inline void apply(Multi const& multi, Grid const& grid,
+                Visitor& visitor)
+    {
+        for (typename boost::range_iterator<Multi const>::type
+                it = boost::begin(multi);
+             it != boost::end(multi);
+             ++it)
+        {
+            Policy::apply(*it, grid, visitor);
+        }
+    }
+};
+
+
+}} // namespace detail::clip_to_grid
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+
+template
+<
+    typename Geometry,
+    typename GeometryOut,
+    typename Tag = typename tag<Geometry>::type
+>
+struct clip_to_grid
+    : not_implemented<Tag>
+{};
+
+template <typename Linestring, typename LinestringOut>
+struct clip_to_grid<Linestring, LinestringOut, linestring_tag>
+    : detail::clip_to_grid::clip_linear<LinestringOut>
+{};
+
+template <typename MultiLinestring, typename LinestringOut>
+struct clip_to_grid<MultiLinestring, LinestringOut, multi_linestring_tag>
+    : detail::clip_to_grid::clip_multi
+        <
+            detail::clip_to_grid::clip_linear<LinestringOut>
+        >
+{};
+
+template <typename Ring, typename PolygonOut>
+struct clip_to_grid<Ring, PolygonOut, ring_tag>
+    : detail::clip_to_grid::clip_areal<PolygonOut>
+{};
+
+template <typename Polygon, typename PolygonOut>
+struct clip_to_grid<Polygon, PolygonOut, polygon_tag>
+    : detail::clip_to_grid::clip_areal<PolygonOut>
+{};
+
+template <typename MultiPolygon, typename PolygonOut>
+struct clip_to_grid<MultiPolygon, PolygonOut, multi_polygon_tag>
+    : detail::clip_to_grid::clip_multi
+        <
+            detail::clip_to_grid::clip_areal<PolygonOut>
+        >
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Clips a geometry by all cells of a regular grid, in one pass
+\ingroup clip_to_grid
+\details The geometry is visited once, each segment is only clipped by the
+    cells it spans. This takes time linear in the number of points plus
+    the size of the output, instead of clipping the geometry by each cell.
+    Per cell the results are the same as those of intersection with the
+    box of the cell. Polygons which would become invalid by clipping are
+    handled by intersection, for the concerned cells only.
+\tparam GeometryOut output type, linestring for linear geometries, polygon
+    for areal geometries
+\tparam Geometry \tparam_geometry
+\tparam Point point type of the grid
+\tparam Visitor type having a method apply(column, row, part)
+\param geometry \param_geometry
+\param grid the grid
+\param visitor visitor which is called for each clipped part, with the
+    column and row of its cell
+*/
+template
+<
+    typename GeometryOut,
+    typename Geometry,
+    typename Point,
+    typename Visitor
+>
+inline void clip_to_grid(Geometry const& geometry,
+            regular_grid<Point> const& grid,
+            Visitor& visitor)
+{
+    concept::check<Geometry const>();
+    concept::check<GeometryOut>();
+
+    dispatch::clip_to_grid
+        <
+            Geometry,
+            GeometryOut
+        >::apply(geometry, grid, visitor);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
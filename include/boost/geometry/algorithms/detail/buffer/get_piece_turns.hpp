@@ -180,7 +180,7 @@ public:
     {}
 
     template <typename Piece>
-    inline void apply(Piece const& piece1, Piece const& piece2,
+    inline bool apply(Piece const& piece1, Piece const& piece2,
                     bool first = true)
     {
         boost::ignore_unused_variable_warning(first);
@@ -188,9 +188,10 @@ public:
           || detail::disjoint::disjoint_box_box(piece1.robust_envelope,
                     piece2.robust_envelope))
         {
-            return;
+            return true;
         }
         calculate_turns(piece1, piece2);
+        return true;
     }
 };
 
@@ -110,20 +110,20 @@ public:
     {}
 
     template <typename Turn, typename Piece>
-    inline void apply(Turn const& turn, Piece const& piece, bool first = true)
+    inline bool apply(Turn const& turn, Piece const& piece, bool first = true)
     {
         boost::ignore_unused_variable_warning(first);
 
         if (turn.count_within > 0)
         {
             // Already inside - no need to check again
-            return;
+            return true;
         }
 
         if (piece.type == strategy::buffer::buffered_flat_end)
         {
             // Turns cannot be inside a flat end (though they can be on border)
-            return;
+            return true;
         }
 
         for (int i = 0; i < 2; i++)
@@ -131,14 +131,14 @@ public:
             // Don't compare against one of the two source-pieces
             if (turn.operations[i].piece_index == piece.index)
             {
-                return;
+                return true;
             }
         }
 
         int geometry_code = detail::within::point_in_geometry(turn.robust_point, piece.robust_ring);
         if (geometry_code == -1)
         {
-            return;
+            return true;
         }
 
         Turn& mutable_turn = m_turns[turn.turn_index];
@@ -160,6 +160,7 @@ public:
             case 1 : mutable_turn.count_within++; break;
             case 0 : mutable_turn.count_on_offsetted++; break;
         }
+        return true;
     }
 };
 
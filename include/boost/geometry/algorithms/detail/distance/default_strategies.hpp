@@ -20,6 +20,9 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISTANCE_DEFAULT_STRATEGIES_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISTANCE_DEFAULT_STRATEGIES_HPP
 
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_same.hpp>
+
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tag_cast.hpp>
@@ -89,6 +92,23 @@ struct default_strategy
 {};
 
 
+// Point-box strategies are available for cartesian and spherical
+// equatorial coordinates. Other coordinate systems use the cartesian one.
+template <typename Point>
+struct point_box_cs_tag
+{
+    typedef typename boost::mpl::if_
+        <
+            boost::is_same
+                <
+                    typename cs_tag<Point>::type,
+                    spherical_equatorial_tag
+                >,
+            spherical_equatorial_tag,
+            cartesian_tag
+        >::type type;
+};
+
 template <typename Pointlike, typename Box>
 struct default_strategy<Pointlike, Box, pointlike_tag, box_tag, false>
     : strategy::distance::services::default_strategy
@@ -96,8 +116,14 @@ struct default_strategy<Pointlike, Box, pointlike_tag, box_tag, false>
               point_tag, box_tag,
               typename point_type<Pointlike>::type,
               typename point_type<Box>::type,
-              cartesian_tag,
-              cartesian_tag,
+              typename point_box_cs_tag
+                  <
+                      typename point_type<Pointlike>::type
+                  >::type,
+              typename point_box_cs_tag
+                  <
+                      typename point_type<Box>::type
+                  >::type,
               void
           >
 {};
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <deque>
 #include <set>
+#include <vector>
 
 #include <boost/range.hpp>
 
@@ -29,15 +30,21 @@
 #include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
 #include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
 
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/num_interior_rings.hpp>
 #include <boost/geometry/algorithms/within.hpp>
 
+#include <boost/geometry/geometries/box.hpp>
+
 #include <boost/geometry/algorithms/detail/check_iterator_range.hpp>
 
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
 
+#include <boost/geometry/algorithms/detail/within/multi_point_in_geometry.hpp>
+
 #include <boost/geometry/algorithms/detail/is_valid/ring.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/complement_graph.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/debug_print_turns.hpp>
@@ -82,27 +89,58 @@ private:
                                         ExteriorRing const& exterior_ring,
                                         IndexSet const& rings_with_turns)
     {
+        typedef typename point_type<Polygon>::type point_type;
+        typedef model::box<point_type> box_type;
+
+        // check only rings whose index is not associated to any turn,
+        // classifying their first points in one batch
+        std::vector<point_type> points;
         int idx = 0;
         for (RingIterator it = first; it != beyond; ++it, ++idx)
         {
-            // check only rings whose index is not associated to any turn
-            if ( rings_with_turns.find(idx) == rings_with_turns.end()
-                 && !geometry::within(range::front(*it), exterior_ring) )
+            if ( rings_with_turns.find(idx) == rings_with_turns.end() )
             {
-                return false;
+                points.push_back(range::front(*it));
             }
         }
 
+        detail::within::multi_point_in_geometry
+            <
+                std::vector<point_type>, ExteriorRing
+            > classifier(points, exterior_ring);
+
+        if ( classifier.outside_envelope_count() > 0 )
+        {
+            return false;
+        }
+
+        std::vector<int> const& codes = classifier.classify();
+        if ( std::find_if(codes.begin(), codes.end(),
+                          is_not_inside()) != codes.end() )
+        {
+            return false;
+        }
+
         // for those rings that do not have any associated turns,
-        // check if they lie inside another ring
+        // check if they lie inside another ring, if they lie within
+        // the envelope of that ring
+        std::vector<box_type> envelopes;
+        for (RingIterator it = first; it != beyond; ++it)
+        {
+            envelopes.push_back(geometry::return_envelope<box_type>(*it));
+        }
+
         idx = 0;
         for (RingIterator it1 = first; it1 != beyond; ++it1, ++idx)
         {
             if ( rings_with_turns.find(idx) == rings_with_turns.end() )
             {
-                for (RingIterator it2 = first; it2 != beyond; ++it2)
+                typename std::vector<box_type>::const_iterator
+                    eit = envelopes.begin();
+                for (RingIterator it2 = first; it2 != beyond; ++it2, ++eit)
                 {
                     if ( it1 != it2
+                         && geometry::covered_by(range::front(*it1), *eit)
                          && geometry::within(range::front(*it1), *it2) )
                     {
                         return false;
@@ -125,6 +163,15 @@ private:
     }
 
 
+    struct is_not_inside
+    {
+        inline bool operator()(int code) const
+        {
+            return code != 1;
+        }
+    };
+
+
     template <typename Turn, typename Method, typename Operation>
     static inline bool check_turn(Turn const& turn,
                                   Method method,
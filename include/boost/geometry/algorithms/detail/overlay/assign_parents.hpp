@@ -125,13 +125,12 @@ struct assign_visitor
     {}
 
     template <typename Item>
-    inline void apply(Item const& outer, Item const& inner, bool first = true)
+    inline bool apply(Item const& outer, Item const& inner, bool first = true)
     {
         if (first && outer.real_area < 0)
         {
             // Reverse arguments
-            apply(inner, outer, false);
-            return;
+            return apply(inner, outer, false);
         }
 
         if (math::larger(outer.real_area, 0))
@@ -154,6 +153,7 @@ struct assign_visitor
                 }
             }
         }
+        return true;
     }
 };
 
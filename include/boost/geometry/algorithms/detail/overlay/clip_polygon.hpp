@@ -0,0 +1,464 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+
+#include <boost/geometry/util/promote_floating_point.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/views/closeable_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace intersection
+{
+
+
+// Assigns the point of segment p1-p2 having the specified value in the
+// specified dimension. That coordinate is assigned exactly, such that the
+// point is located exactly on the side of a box
+template <std::size_t Dimension, typename Point, typename T>
+inline void segment_point_at(Point const& p1, Point const& p2,
+            T const& value, Point& ip)
+{
+    static std::size_t const other = 1 - Dimension;
+
+    typedef typename coordinate_type<Point>::type coordinate_type;
+    typedef typename promote_floating_point
+        <
+            typename select_most_precise<coordinate_type, T>::type
+        >::type calculation_type;
+
+    calculation_type const side = value;
+    calculation_type const d1 = geometry::get<Dimension>(p1);
+    calculation_type const d2 = geometry::get<Dimension>(p2);
+    calculation_type const o1 = geometry::get<other>(p1);
+    calculation_type const o2 = geometry::get<other>(p2);
+
+    geometry::set<Dimension>(ip, boost::numeric_cast<coordinate_type>(value));
+    geometry::set<other>(ip,
+        boost::numeric_cast<coordinate_type>(
+            o1 + (o2 - o1) * (side - d1) / (d2 - d1)));
+}
+
+
+// Removes duplicate consecutive points of a range of points
+template <typename Points>
+inline void remove_consecutive_duplicates(Points& points)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        if (count == 0
+            || ! detail::equals::equals_point_point(points[count - 1], points[i]))
+        {
+            points[count++] = points[i];
+        }
+    }
+    points.resize(count);
+}
+
+
+// Removes duplicate consecutive points of an open ring, also
+// the last point if it is equal to the first point
+template <typename Points>
+inline void remove_cyclic_duplicates(Points& points)
+{
+    remove_consecutive_duplicates(points);
+    while (points.size() > 1
+        && detail::equals::equals_point_point(points.front(), points.back()))
+    {
+        points.pop_back();
+    }
+}
+
+
+/*!
+\brief Clips an (open) range of points by one side of a box,
+    the Sutherland-Hodgman way
+\tparam Dimension 0 (x) or 1 (y)
+\tparam Corner min_corner or max_corner
+*/
+template <std::size_t Dimension, std::size_t Corner>
+struct clip_by_box_side
+{
+    template <typename Box, typename Point>
+    static inline bool visible(Box const& box, Point const& point)
+    {
+        return Corner == min_corner
+            ? geometry::get<Dimension>(point) >= geometry::get<Corner, Dimension>(box)
+            : geometry::get<Dimension>(point) <= geometry::get<Corner, Dimension>(box)
+            ;
+    }
+
+    template <typename Box, typename Point>
+    static inline void intersect(Box const& box,
+                Point const& p1, Point const& p2, Point& ip)
+    {
+        segment_point_at<Dimension>(p1, p2,
+            geometry::get<Corner, Dimension>(box), ip);
+    }
+
+    template <typename Box, typename Points>
+    static inline void apply(Box const& box, Points const& input, Points& output)
+    {
+        typedef typename boost::range_value<Points>::type point_type;
+        typedef typename boost::range_iterator<Points const>::type iterator_type;
+
+        output.clear();
+        if (boost::empty(input))
+        {
+            return;
+        }
+
+        point_type const* previous = &range::back(input);
+        bool previous_visible = visible(box, *previous);
+        for (iterator_type it = boost::begin(input); it != boost::end(input); ++it)
+        {
+            bool const current_visible = visible(box, *it);
+            if (current_visible != previous_visible)
+            {
+                point_type ip;
+                intersect(box, *previous, *it, ip);
+                output.push_back(ip);
+            }
+            if (current_visible)
+            {
+                output.push_back(*it);
+            }
+            previous = &(*it);
+            previous_visible = current_visible;
+        }
+    }
+};
+
+
+// Clips a ring by all four sides of a box. The result is an open range
+// without duplicate points, and might be degenerate
+template <typename Box, typename Ring, typename Points>
+inline void clip_ring_with_box(Box const& box, Ring const& ring, Points& points)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+    typedef typename closeable_view
+        <
+            Ring const, geometry::closure<Ring>::value
+        >::type view_type;
+
+    view_type view(ring);
+    Points work;
+    for (typename boost::range_iterator<view_type const>::type
+            it = boost::begin(view);
+         it != boost::end(view);
+         ++it)
+    {
+        point_type p;
+        geometry::convert(*it, p);
+        work.push_back(p);
+    }
+    if (! work.empty())
+    {
+        // Make it open, the clippers handle the closing segment
+        work.pop_back();
+    }
+
+    clip_by_box_side<0, min_corner>::apply(box, work, points);
+    clip_by_box_side<0, max_corner>::apply(box, points, work);
+    clip_by_box_side<1, min_corner>::apply(box, work, points);
+    clip_by_box_side<1, max_corner>::apply(box, points, work);
+
+    points.swap(work);
+    remove_cyclic_duplicates(points);
+}
+
+
+// Returns the interval along the perimeter of the box (counterclockwise,
+// starting at the lower left corner) of a segment located on one side
+template <typename Box, typename Point, typename T>
+inline bool perimeter_interval(Box const& box,
+            Point const& p1, Point const& p2, std::pair<T, T>& interval)
+{
+    // The box is compared in the coordinate type of the clipped points,
+    // which got their coordinates on the border from the box
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    T const min_x = coordinate_type(geometry::get<min_corner, 0>(box));
+    T const min_y = coordinate_type(geometry::get<min_corner, 1>(box));
+    T const max_x = coordinate_type(geometry::get<max_corner, 0>(box));
+    T const max_y = coordinate_type(geometry::get<max_corner, 1>(box));
+    T const x1 = geometry::get<0>(p1);
+    T const y1 = geometry::get<1>(p1);
+    T const x2 = geometry::get<0>(p2);
+    T const y2 = geometry::get<1>(p2);
+    T const width = max_x - min_x;
+    T const height = max_y - min_y;
+
+    T t1 = 0, t2 = 0;
+    if (y1 == min_y && y2 == min_y)
+    {
+        t1 = x1 - min_x;
+        t2 = x2 - min_x;
+    }
+    else if (x1 == max_x && x2 == max_x)
+    {
+        t1 = width + y1 - min_y;
+        t2 = width + y2 - min_y;
+    }
+    else if (y1 == max_y && y2 == max_y)
+    {
+        t1 = width + height + max_x - x1;
+        t2 = width + height + max_x - x2;
+    }
+    else if (x1 == min_x && x2 == min_x)
+    {
+        t1 = width + height + width + max_y - y1;
+        t2 = width + height + width + max_y - y2;
+    }
+    else
+    {
+        return false;
+    }
+
+    interval = t1 < t2 ? std::make_pair(t1, t2) : std::make_pair(t2, t1);
+    return true;
+}
+
+
+// Returns true if the clipped ring runs more than once over a part of
+// the border of the box. Sutherland-Hodgman then has connected separate
+// parts by degenerate edges, and the result is not valid.
+template <typename Box, typename Points>
+inline bool has_overlapping_border_segments(Box const& box, Points const& points)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+    typedef typename promote_floating_point
+        <
+            typename coordinate_type<point_type>::type
+        >::type calculation_type;
+    typedef std::pair<calculation_type, calculation_type> interval_type;
+
+    std::vector<interval_type> intervals;
+    std::size_t const n = points.size();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        interval_type interval;
+        if (perimeter_interval(box, points[i], points[(i + 1) % n], interval))
+        {
+            intervals.push_back(interval);
+        }
+    }
+
+    std::sort(intervals.begin(), intervals.end());
+    for (std::size_t i = 1; i < intervals.size(); i++)
+    {
+        if (intervals[i].first < intervals[i - 1].second)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Returns 1 if the box contains the ring strictly in its interior,
+// -1 if the ring is located outside the box (possibly touching it),
+// and 0 otherwise
+template <typename Box, typename Ring>
+inline int ring_box_position(Box const& box, Ring const& ring)
+{
+    bool inside = true;
+    bool below = true, above = true, left = true, right = true;
+    for (typename boost::range_iterator<Ring const>::type
+            it = boost::begin(ring);
+         it != boost::end(ring);
+         ++it)
+    {
+        bool const l = geometry::get<0>(*it) <= geometry::get<min_corner, 0>(box);
+        bool const r = geometry::get<0>(*it) >= geometry::get<max_corner, 0>(box);
+        bool const b = geometry::get<1>(*it) <= geometry::get<min_corner, 1>(box);
+        bool const a = geometry::get<1>(*it) >= geometry::get<max_corner, 1>(box);
+        inside = inside && ! (l || r || b || a);
+        left = left && l;
+        right = right && r;
+        below = below && b;
+        above = above && a;
+    }
+    return inside ? 1 : (left || right || below || above) ? -1 : 0;
+}
+
+
+template <typename Points>
+inline bool has_area(Points const& points)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+    typedef typename promote_floating_point
+        <
+            typename coordinate_type<point_type>::type
+        >::type calculation_type;
+
+    std::size_t const n = points.size();
+    if (n < 3)
+    {
+        return false;
+    }
+
+    calculation_type sum = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        point_type const& p1 = points[i];
+        point_type const& p2 = points[(i + 1) % n];
+        sum += calculation_type(geometry::get<0>(p1)) * geometry::get<1>(p2)
+             - calculation_type(geometry::get<0>(p2)) * geometry::get<1>(p1);
+    }
+    return sum != 0;
+}
+
+
+/*!
+\brief Clips a polygon (or ring) by a box, in linear time
+\details The exterior ring is clipped by Sutherland-Hodgman. Interior rings
+    should be located either completely inside or outside the box.
+    If the clipped result would not be valid (degenerate edges along the
+    box, or interior rings crossing the box), nothing is written
+    and false is returned, and the caller should use the general overlay.
+\tparam GeometryOut output polygon type
+\tparam Reverse true if the output orientation differs from the input
+*/
+template <typename GeometryOut, bool Reverse>
+struct clip_polygon_with_box
+{
+    typedef typename geometry::point_type<GeometryOut>::type point_type;
+    typedef typename ring_type<GeometryOut>::type ring_type;
+
+    template <typename Polygon, typename Box, typename OutputIterator>
+    static inline bool apply(Polygon const& polygon, Box const& box,
+                OutputIterator& out)
+    {
+        return apply(polygon, box, out, typename tag<Polygon>::type());
+    }
+
+private :
+
+    template <typename Ring, typename Box, typename OutputIterator>
+    static inline bool apply(Ring const& ring, Box const& box,
+                OutputIterator& out, ring_tag)
+    {
+        std::vector<Ring const*> interiors;
+        return clip(ring, interiors, box, out);
+    }
+
+    template <typename Polygon, typename Box, typename OutputIterator>
+    static inline bool apply(Polygon const& polygon, Box const& box,
+                OutputIterator& out, polygon_tag)
+    {
+        typedef typename geometry::ring_type<Polygon>::type ring_type_in;
+
+        std::vector<ring_type_in const*> interiors;
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings);
+             it != boost::end(rings);
+             ++it)
+        {
+            int const position = ring_box_position(box, *it);
+            if (position == 0)
+            {
+                return false;
+            }
+            if (position == 1)
+            {
+                interiors.push_back(&(*it));
+            }
+        }
+
+        return clip(exterior_ring(polygon), interiors, box, out);
+    }
+
+    template <typename Ring, typename Box, typename OutputIterator>
+    static inline bool clip(Ring const& exterior,
+                std::vector<Ring const*> const& interiors,
+                Box const& box, OutputIterator& out)
+    {
+        std::vector<point_type> points;
+        clip_ring_with_box(box, exterior, points);
+
+        if (! has_area(points))
+        {
+            // Disjoint, or touching the box
+            return true;
+        }
+        if (has_overlapping_border_segments(box, points))
+        {
+            return false;
+        }
+
+        GeometryOut result;
+        ring_type& ring_out = exterior_ring(result);
+        if (Reverse)
+        {
+            std::reverse(points.begin(), points.end());
+        }
+        for (typename std::vector<point_type>::const_iterator
+                it = points.begin(); it != points.end(); ++it)
+        {
+            range::push_back(ring_out, *it);
+        }
+        if (geometry::closure<ring_type>::value == closed)
+        {
+            range::push_back(ring_out, points.front());
+        }
+
+        // Interior rings are located inside the box, and copied.
+        // Conversion takes care of orientation and closure.
+        for (std::size_t i = 0; i < interiors.size(); i++)
+        {
+            interior_rings(result).resize(interior_rings(result).size() + 1);
+            geometry::convert(*interiors[i], range::back(interior_rings(result)));
+        }
+
+        *out++ = result;
+        return true;
+    }
+};
+
+
+}} // namespace detail::intersection
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
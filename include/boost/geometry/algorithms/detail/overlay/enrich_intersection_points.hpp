@@ -11,7 +11,6 @@
 
 #include <cstddef>
 #include <algorithm>
-#include <map>
 #include <set>
 #include <vector>
 
@@ -24,6 +23,7 @@
 
 #include <boost/assert.hpp>
 #include <boost/range.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <boost/geometry/algorithms/detail/ring_identifier.hpp>
 #include <boost/geometry/algorithms/detail/overlay/copy_segment_point.hpp>
@@ -70,6 +70,33 @@ struct remove_discarded
     }
 };
 
+template <typename SegmentIdentifier>
+inline ring_identifier ring_id_of(SegmentIdentifier const& seg_id)
+{
+    return ring_identifier(seg_id.source_index,
+                           seg_id.multi_index,
+                           seg_id.ring_index);
+}
+
+// Sorts indexed operations on ring, and per ring on turn index and
+// operation index: the order in which they are added
+struct sort_on_ring
+{
+    template <typename IndexedTurnOperation>
+    inline bool operator()(IndexedTurnOperation const& left,
+                           IndexedTurnOperation const& right) const
+    {
+        ring_identifier const left_id = ring_id_of(left.subject.seg_id);
+        ring_identifier const right_id = ring_id_of(right.subject.seg_id);
+
+        return left_id == right_id
+            ? (left.index != right.index
+                ? left.index < right.index
+                : left.operation_index < right.operation_index)
+            : left_id < right_id;
+    }
+};
+
 
 template
 <
@@ -295,23 +322,23 @@ inline void enrich_sort(Container& operations,
 }
 
 
+// Returns the end of the operations which are not discarded
 template
 <
     typename IndexType,
     typename Container,
     typename TurnPoints
 >
-inline void enrich_discard(Container& operations, TurnPoints& turn_points)
+inline typename boost::range_iterator<Container>::type
+    enrich_discard(Container& operations, TurnPoints& turn_points)
 {
     update_discarded(turn_points, operations);
 
-    // Then delete discarded operations from vector
+    // Then move discarded operations to the end
     remove_discarded<IndexType> predicate;
-    operations.erase(
-            std::remove_if(boost::begin(operations),
+    return std::remove_if(boost::begin(operations),
                     boost::end(operations),
-                    predicate),
-            boost::end(operations));
+                    predicate);
 }
 
 template
@@ -395,11 +422,15 @@ inline void enrich_assign(Container& operations,
 }
 
 
-template <typename IndexedType, typename TurnPoints, typename MappedVector>
-inline void create_map(TurnPoints const& turn_points, MappedVector& mapped_vector)
+// Collects the operations of all rings in one vector, sorted on ring,
+// and assigns the range of operations of each ring
+template <typename IndexedType, typename TurnPoints, typename Operations, typename Rings>
+inline void create_rings(TurnPoints const& turn_points,
+            Operations& operations, Rings& rings)
 {
     typedef typename boost::range_value<TurnPoints>::type turn_point_type;
     typedef typename turn_point_type::container_type container_type;
+    typedef typename boost::range_iterator<Operations>::type iterator_type;
 
     int index = 0;
     for (typename boost::range_iterator<TurnPoints const>::type
@@ -420,19 +451,27 @@ inline void create_map(TurnPoints const& turn_points, MappedVector& mapped_vecto
                 // because they can be relevant for "the other side"
                 // NOT if (op_it->operation != operation_blocked)
 
-                ring_identifier ring_id
-                    (
-                        op_it->seg_id.source_index,
-                        op_it->seg_id.multi_index,
-                        op_it->seg_id.ring_index
-                    );
-                mapped_vector[ring_id].push_back
-                    (
-                        IndexedType(index, op_index, *op_it)
-                    );
+                operations.push_back(IndexedType(index, op_index, *op_it));
             }
         }
     }
+
+    std::sort(boost::begin(operations), boost::end(operations),
+              sort_on_ring());
+
+    iterator_type first = boost::begin(operations);
+    for (iterator_type it = first; it != boost::end(operations); ++it)
+    {
+        if (! (ring_id_of(it->subject.seg_id) == ring_id_of(first->subject.seg_id)))
+        {
+            rings.push_back(typename boost::range_value<Rings>::type(first, it));
+            first = it;
+        }
+    }
+    if (first != boost::end(operations))
+    {
+        rings.push_back(typename boost::range_value<Rings>::type(first, boost::end(operations)));
+    }
 }
 
 
@@ -477,11 +516,10 @@ inline void enrich_intersection_points(TurnPoints& turn_points,
             turn_operation_type
         > indexed_turn_operation;
 
-    typedef std::map
-        <
-            ring_identifier,
-            std::vector<indexed_turn_operation>
-        > mapped_vector_type;
+    typedef std::vector<indexed_turn_operation> operations_type;
+    typedef typename boost::range_iterator<operations_type>::type iterator_type;
+    typedef boost::iterator_range<iterator_type> ring_operations_type;
+    typedef std::vector<ring_operations_type> rings_type;
 
     // DISCARD ALL UU
     // #76 is the reason that this is necessary...
@@ -503,50 +541,52 @@ inline void enrich_intersection_points(TurnPoints& turn_points,
     }
 
 
-    // Create a map of vectors of indexed operation-types to be able
-    // to sort intersection points PER RING
-    mapped_vector_type mapped_vector;
+    // Create one vector of indexed operation-types, sorted on ring, to be
+    // able to sort intersection points PER RING, in ring order
+    operations_type operations;
+    rings_type rings;
 
-    detail::overlay::create_map<indexed_turn_operation>(turn_points, mapped_vector);
+    detail::overlay::create_rings<indexed_turn_operation>(turn_points,
+                operations, rings);
 
 
-    // No const-iterator; contents of mapped copy is temporary,
-    // and changed by enrich
-    for (typename mapped_vector_type::iterator mit
-        = mapped_vector.begin();
-        mit != mapped_vector.end();
-        ++mit)
+    // Contents of the operations is temporary, and changed by enrich
+    for (typename rings_type::iterator rit = rings.begin();
+        rit != rings.end();
+        ++rit)
     {
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
     std::cout << "ENRICH-sort Ring "
-        << mit->first << std::endl;
+        << detail::overlay::ring_id_of(rit->front().subject.seg_id) << std::endl;
 #endif
-        detail::overlay::enrich_sort<indexed_turn_operation, Reverse1, Reverse2>(mit->second, turn_points, for_operation,
+        detail::overlay::enrich_sort<indexed_turn_operation, Reverse1, Reverse2>(*rit, turn_points, for_operation,
                     geometry1, geometry2, robust_policy, strategy);
     }
 
-    for (typename mapped_vector_type::iterator mit
-        = mapped_vector.begin();
-        mit != mapped_vector.end();
-        ++mit)
+    for (typename rings_type::iterator rit = rings.begin();
+        rit != rings.end();
+        ++rit)
     {
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
     std::cout << "ENRICH-discard Ring "
-        << mit->first << std::endl;
+        << detail::overlay::ring_id_of(rit->front().subject.seg_id) << std::endl;
 #endif
-        detail::overlay::enrich_discard<indexed_turn_operation>(mit->second, turn_points);
+        *rit = ring_operations_type(boost::begin(*rit),
+            detail::overlay::enrich_discard<indexed_turn_operation>(*rit, turn_points));
     }
 
-    for (typename mapped_vector_type::iterator mit
-        = mapped_vector.begin();
-        mit != mapped_vector.end();
-        ++mit)
+    for (typename rings_type::iterator rit = rings.begin();
+        rit != rings.end();
+        ++rit)
     {
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
-    std::cout << "ENRICH-assign Ring "
-        << mit->first << std::endl;
+    if (! rit->empty())
+    {
+        std::cout << "ENRICH-assign Ring "
+            << detail::overlay::ring_id_of(rit->front().subject.seg_id) << std::endl;
+    }
 #endif
-        detail::overlay::enrich_assign<indexed_turn_operation>(mit->second, turn_points, for_operation,
+        detail::overlay::enrich_assign<indexed_turn_operation>(*rit, turn_points, for_operation,
                     geometry1, geometry2, strategy);
     }
 
@@ -14,6 +14,7 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURN_INFO_HELPERS_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_GET_TURN_INFO_HELPERS_HPP
 
+#include <boost/geometry/policies/robustness/base_robust_policy.hpp>
 #include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
 
 namespace boost { namespace geometry {
@@ -189,9 +190,18 @@ private:
 
 template <typename Point1, typename Point2, typename TurnPoint, typename RobustPolicy>
 class intersection_info
-    : public intersection_info_base<Point1, Point2, RobustPolicy>
+    : public intersection_info_base
+        <
+            Point1, Point2,
+            typename base_robust_policy<RobustPolicy>::type
+        >
 {
-    typedef intersection_info_base<Point1, Point2, RobustPolicy> base_t;
+    // Policies wrapping no_rescale_policy select its specialization as well
+    typedef intersection_info_base
+        <
+            Point1, Point2,
+            typename base_robust_policy<RobustPolicy>::type
+        > base_t;
 
     typedef typename strategy_intersection
         <
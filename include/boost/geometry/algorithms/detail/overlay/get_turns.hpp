@@ -468,6 +468,22 @@ struct section_visitor
 
 };
 
+// Creates the monotonic sections of a geometry. Specialized for robust
+// policies carrying sections which were created beforehand (see prepared.hpp)
+template <typename RobustPolicy>
+struct get_sections
+{
+    template <bool Reverse, typename Geometry, typename Sections>
+    static inline Sections const& apply(Geometry const& geometry,
+            RobustPolicy const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        geometry::sectionalize<Reverse>(geometry, robust_policy, true,
+                sections, source_index);
+        return sections;
+    }
+};
+
 template
 <
     typename Geometry1, typename Geometry2,
@@ -501,8 +517,10 @@ public:
 
         sections_type sec1, sec2;
 
-        geometry::sectionalize<Reverse1>(geometry1, robust_policy, true, sec1, 0);
-        geometry::sectionalize<Reverse2>(geometry2, robust_policy, true, sec2, 1);
+        sections_type const& sections1 = get_sections<RobustPolicy>
+            ::template apply<Reverse1>(geometry1, robust_policy, sec1, 0);
+        sections_type const& sections2 = get_sections<RobustPolicy>
+            ::template apply<Reverse2>(geometry2, robust_policy, sec2, 1);
 
         // ... and then partition them, intersecting overlapping sections in visitor method
         section_visitor
@@ -515,7 +533,7 @@ public:
         geometry::partition
             <
                 box_type, get_section_box, ovelaps_section_box
-            >::apply(sec1, sec2, visitor);
+            >::apply(sections1, sections2, visitor);
     }
 };
 
@@ -29,6 +29,7 @@
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/point_on_border.hpp>
 #include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_intersection_points.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
@@ -55,6 +56,42 @@ namespace boost { namespace geometry
 namespace detail { namespace intersection
 {
 
+template
+<
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_areal_box
+{
+    template
+    <
+        typename Geometry, typename Box,
+        typename RobustPolicy,
+        typename OutputIterator, typename Strategy
+    >
+    static inline OutputIterator apply(Geometry const& geometry,
+            Box const& box,
+            RobustPolicy const& robust_policy,
+            OutputIterator out,
+            Strategy const& strategy)
+    {
+        if (! clip_polygon_with_box
+                <
+                    GeometryOut, Reverse1 != ReverseOut
+                >::apply(geometry, box, out))
+        {
+            // The clipped polygon would not be valid, use the general overlay
+            out = detail::overlay::overlay
+                <
+                    Geometry, Box,
+                    Reverse1, Reverse2, ReverseOut,
+                    GeometryOut, overlay_intersection
+                >::apply(geometry, box, robust_policy, out, strategy);
+        }
+        return out;
+    }
+};
+
 template <typename PointOut>
 struct intersection_segment_segment_point
 {
@@ -351,6 +388,49 @@ struct intersection_insert
 {};
 
 
+// Polygon or ring with box, intersection: clipped in linear time
+template
+<
+    typename Geometry, typename Box,
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_insert
+    <
+        Geometry, Box,
+        GeometryOut,
+        overlay_intersection,
+        Reverse1, Reverse2, ReverseOut,
+        polygon_tag, box_tag, polygon_tag,
+        true, true, true
+    > : detail::intersection::intersection_areal_box
+        <
+            GeometryOut, Reverse1, Reverse2, ReverseOut
+        >
+{};
+
+
+template
+<
+    typename Geometry, typename Box,
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_insert
+    <
+        Geometry, Box,
+        GeometryOut,
+        overlay_intersection,
+        Reverse1, Reverse2, ReverseOut,
+        ring_tag, box_tag, polygon_tag,
+        true, true, true
+    > : detail::intersection::intersection_areal_box
+        <
+            GeometryOut, Reverse1, Reverse2, ReverseOut
+        >
+{};
+
+
 template
 <
     typename Segment1, typename Segment2,
@@ -149,6 +149,21 @@ inline OutputIterator return_if_one_input_is_empty(Geometry1 const& geometry1,
 }
 
 
+// Provides the container for the turns. Specialized for robust policies
+// carrying an overlay context (see overlay_context.hpp), which keeps the
+// turns, and their memory, between calls
+template <typename RobustPolicy, typename TurnInfo>
+struct get_turn_container
+{
+    typedef std::deque<TurnInfo> type;
+
+    static inline type& apply(RobustPolicy const& , type& turns)
+    {
+        return turns;
+    }
+};
+
+
 template
 <
     typename Geometry1, typename Geometry2,
@@ -186,14 +201,16 @@ struct overlay
             point_type,
             typename geometry::segment_ratio_type<point_type, RobustPolicy>::type
         > turn_info;
-        typedef std::deque<turn_info> container_type;
+        typedef get_turn_container<RobustPolicy, turn_info> turn_container;
 
         typedef std::deque
             <
                 typename geometry::ring_type<GeometryOut>::type
             > ring_container_type;
 
-        container_type turn_points;
+        typename turn_container::type local_turn_points;
+        typename turn_container::type& turn_points
+            = turn_container::apply(robust_policy, local_turn_points);
 
 #ifdef BOOST_GEOMETRY_TIME_OVERLAY
         boost::timer timer;
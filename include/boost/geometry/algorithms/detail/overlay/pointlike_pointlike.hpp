@@ -25,6 +25,7 @@
 #include <boost/geometry/algorithms/not_implemented.hpp>
 
 #include <boost/geometry/algorithms/detail/relate/less.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_set.hpp>
 #include <boost/geometry/algorithms/detail/equals/point_point.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
 
@@ -264,17 +265,17 @@ struct multipoint_multipoint_point
                 >::apply(multipoint2, multipoint1, robust_policy, oit, strategy);
         }
 
-        std::vector<typename point_type<MultiPoint2>::type>
-            points2(boost::begin(multipoint2), boost::end(multipoint2));
-
-        std::sort(points2.begin(), points2.end(), detail::relate::less());
+        detail::relate::point_set
+            <
+                typename point_type<MultiPoint2>::type,
+                typename point_type<MultiPoint1>::type
+            > const points2(multipoint2);
 
         for (typename boost::range_iterator<MultiPoint1 const>::type
                  it1 = boost::begin(multipoint1);
              it1 != boost::end(multipoint1); ++it1)
         {
-            bool found = std::binary_search(points2.begin(), points2.end(),
-                                            *it1, detail::relate::less());
+            bool found = points2.contains(*it1);
 
             action_selector_pl_pl
                 <
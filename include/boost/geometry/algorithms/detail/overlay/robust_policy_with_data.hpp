@@ -0,0 +1,131 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_ROBUST_POLICY_WITH_DATA_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_ROBUST_POLICY_WITH_DATA_HPP
+
+
+#include <boost/type_traits/remove_const.hpp>
+
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/policies/robustness/base_robust_policy.hpp>
+#include <boost/geometry/policies/robustness/robust_point_type.hpp>
+#include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace overlay
+{
+
+// Robust policy, behaving as the policy it is derived from, and carrying
+// data through the overlay process. The data is an overlay context (see
+// overlay_context.hpp) or a prepared geometry (see prepared.hpp), of which
+// get_turns takes its sections, and the overlay its turn container.
+template <typename RobustPolicy, typename Data>
+struct robust_policy_with_data : public RobustPolicy
+{
+    typedef RobustPolicy base_policy_type;
+    typedef Data data_type;
+
+    inline robust_policy_with_data(RobustPolicy const& policy, Data& data)
+        : RobustPolicy(policy)
+        , m_data(&data)
+    {}
+
+    inline Data& data() const
+    {
+        return *m_data;
+    }
+
+    Data* m_data;
+};
+
+
+// Provides the sections of a geometry, from the data of the policy.
+// By default the geometry is sectionalized, as without data.
+template <typename Data>
+struct sections_from_data
+{
+    template <bool Reverse, typename Geometry, typename RobustPolicy, typename Sections>
+    static inline Sections const& apply(Geometry const& geometry,
+            RobustPolicy const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        geometry::sectionalize<Reverse>(geometry, robust_policy, true,
+                sections, source_index);
+        return sections;
+    }
+};
+
+
+}} // namespace detail::overlay
+
+
+namespace detail { namespace get_turns
+{
+
+template <typename RobustPolicy, typename Data>
+struct get_sections<detail::overlay::robust_policy_with_data<RobustPolicy, Data> >
+{
+    template <bool Reverse, typename Geometry, typename Sections>
+    static inline Sections const& apply(Geometry const& geometry,
+            detail::overlay::robust_policy_with_data
+                <
+                    RobustPolicy, Data
+                > const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        return detail::overlay::sections_from_data
+            <
+                typename boost::remove_const<Data>::type
+            >::template apply<Reverse>(geometry, robust_policy,
+                sections, source_index);
+    }
+};
+
+}} // namespace detail::get_turns
+#endif // DOXYGEN_NO_DETAIL
+
+
+// Implement meta-functions for this policy, forwarding to the base policy
+template <typename RobustPolicy, typename Data>
+struct base_robust_policy
+    <
+        detail::overlay::robust_policy_with_data<RobustPolicy, Data>
+    >
+    : base_robust_policy<RobustPolicy>
+{};
+
+template <typename Point, typename RobustPolicy, typename Data>
+struct robust_point_type
+    <
+        Point,
+        detail::overlay::robust_policy_with_data<RobustPolicy, Data>
+    >
+    : robust_point_type<Point, RobustPolicy>
+{};
+
+template <typename Point, typename RobustPolicy, typename Data>
+struct segment_ratio_type
+    <
+        Point,
+        detail::overlay::robust_policy_with_data<RobustPolicy, Data>
+    >
+    : segment_ratio_type<Point, RobustPolicy>
+{};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_ROBUST_POLICY_WITH_DATA_HPP
@@ -50,8 +50,6 @@ struct no_interrupt_policy
 
 
 
-class self_ip_exception : public geometry::exception {};
-
 template
 <
     typename Geometry,
@@ -96,13 +94,8 @@ struct self_section_visitor
                             m_rescale_policy,
                             m_turns, m_interrupt_policy);
         }
-        if (m_interrupt_policy.has_intersections)
-        {
-            // TODO: we should give partition an interrupt policy.
-            // Now we throw, and catch below, to stop the partition loop.
-            throw self_ip_exception();
-        }
-        return true;
+        // Stop the partition loop if intersections are found
+        return ! m_interrupt_policy.has_intersections;
     }
 
 };
@@ -137,21 +130,14 @@ struct get_turns
                 Turns, TurnPolicy, RobustPolicy, InterruptPolicy
             > visitor(geometry, robust_policy, turns, interrupt_policy);
 
-        try
-        {
-            geometry::partition
-                <
-                    box_type,
-                    detail::get_turns::get_section_box,
-                    detail::get_turns::ovelaps_section_box
-                >::apply(sec, visitor);
-        }
-        catch(self_ip_exception const& )
-        {
-            return false;
-        }
+        geometry::partition
+            <
+                box_type,
+                detail::get_turns::get_section_box,
+                detail::get_turns::ovelaps_section_box
+            >::apply(sec, visitor);
 
-        return true;
+        return ! interrupt_policy.has_intersections;
     }
 };
 
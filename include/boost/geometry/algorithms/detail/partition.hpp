@@ -22,6 +22,33 @@ namespace detail { namespace partition
 
 typedef std::vector<std::size_t> index_vector_type;
 
+// Visitors may return bool, false to stop, or void, to visit all pairs.
+// A void result is not passed to the comma operator below, so the built-in
+// comma operator returns continue_visiting.
+struct continue_visiting {};
+
+inline bool operator,(bool result, continue_visiting)
+{
+    return result;
+}
+
+inline bool is_continued(bool result)
+{
+    return result;
+}
+
+inline bool is_continued(continue_visiting)
+{
+    return true;
+}
+
+// Calls the visitor for a pair, returns false if the visitor stopped
+template <typename Policy, typename Item1, typename Item2>
+inline bool visit(Policy& policy, Item1 const& item1, Item2 const& item2)
+{
+    return is_continued((policy.apply(item1, item2), continue_visiting()));
+}
+
 template <int Dimension, typename Box>
 void divide_box(Box const& box, Box& lower_box, Box& upper_box)
 {
@@ -84,9 +111,9 @@ inline void divide_into_subsets(Box const& lower_box,
     }
 }
 
-// Match collection with itself
+// Match collection with itself, returns false if the visitor stopped
 template <typename InputCollection, typename Policy>
-inline void handle_one(InputCollection const& collection,
+inline bool handle_one(InputCollection const& collection,
         index_vector_type const& input,
         Policy& policy)
 {
@@ -100,19 +127,23 @@ inline void handle_one(InputCollection const& collection,
         index_iterator_type it2 = it1;
         for(++it2; it2 != boost::end(input); ++it2)
         {
-            policy.apply(collection[*it1], collection[*it2]);
+            if (! visit(policy, collection[*it1], collection[*it2]))
+            {
+                return false;
+            }
         }
     }
+    return true;
 }
 
-// Match collection 1 with collection 2
+// Match collection 1 with collection 2, returns false if the visitor stopped
 template
 <
     typename InputCollection1,
     typename InputCollection2,
     typename Policy
 >
-inline void handle_two(
+inline bool handle_two(
         InputCollection1 const& collection1, index_vector_type const& input1,
         InputCollection2 const& collection2, index_vector_type const& input2,
         Policy& policy)
@@ -130,9 +161,13 @@ inline void handle_two(
             it2 != boost::end(input2);
             ++it2)
         {
-            policy.apply(collection1[*it1], collection2[*it2]);
+            if (! visit(policy, collection1[*it1], collection2[*it2]))
+            {
+                return false;
+            }
         }
     }
+    return true;
 }
 
 template
@@ -155,7 +190,7 @@ class partition_one_collection
             > sub_divide;
 
     template <typename InputCollection, typename Policy>
-    static inline void next_level(Box const& box,
+    static inline bool next_level(Box const& box,
             InputCollection const& collection,
             index_vector_type const& input,
             int level, std::size_t min_elements,
@@ -165,19 +200,20 @@ class partition_one_collection
         {
             if (std::size_t(boost::size(input)) > min_elements && level < 100)
             {
-                sub_divide::apply(box, collection, input, level + 1,
+                return sub_divide::apply(box, collection, input, level + 1,
                             min_elements, policy, box_policy);
             }
             else
             {
-                handle_one(collection, input, policy);
+                return handle_one(collection, input, policy);
             }
         }
+        return true;
     }
 
 public :
     template <typename InputCollection, typename Policy>
-    static inline void apply(Box const& box,
+    static inline bool apply(Box const& box,
             InputCollection const& collection,
             index_vector_type const& input,
             int level,
@@ -197,15 +233,18 @@ public :
         {
             // All what is not fitting a partition should be combined
             // with each other, and with all which is fitting.
-            handle_one(collection, exceeding, policy);
-            handle_two(collection, exceeding, collection, lower, policy);
-            handle_two(collection, exceeding, collection, upper, policy);
+            if (! handle_one(collection, exceeding, policy)
+                || ! handle_two(collection, exceeding, collection, lower, policy)
+                || ! handle_two(collection, exceeding, collection, upper, policy))
+            {
+                return false;
+            }
         }
 
         // Recursively call operation both parts
-        next_level(lower_box, collection, lower, level, min_elements,
-                        policy, box_policy);
-        next_level(upper_box, collection, upper, level, min_elements,
+        return next_level(lower_box, collection, lower, level, min_elements,
+                        policy, box_policy)
+            && next_level(upper_box, collection, upper, level, min_elements,
                         policy, box_policy);
     }
 };
@@ -237,7 +276,7 @@ class partition_two_collections
         typename InputCollection2,
         typename Policy
     >
-    static inline void next_level(Box const& box,
+    static inline bool next_level(Box const& box,
             InputCollection1 const& collection1,
             index_vector_type const& input1,
             InputCollection2 const& collection2,
@@ -251,16 +290,17 @@ class partition_two_collections
                 && std::size_t(boost::size(input2)) > min_elements
                 && level < 100)
             {
-                sub_divide::apply(box, collection1, input1, collection2,
+                return sub_divide::apply(box, collection1, input1, collection2,
                                 input2, level + 1, min_elements,
                                 policy, box_policy);
             }
             else
             {
                 box_policy.apply(box, level + 1);
-                handle_two(collection1, input1, collection2, input2, policy);
+                return handle_two(collection1, input1, collection2, input2, policy);
             }
         }
+        return true;
     }
 
 public :
@@ -270,7 +310,7 @@ public :
         typename InputCollection2,
         typename Policy
     >
-    static inline void apply(Box const& box,
+    static inline bool apply(Box const& box,
             InputCollection1 const& collection1, index_vector_type const& input1,
             InputCollection2 const& collection2, index_vector_type const& input2,
             int level,
@@ -292,23 +332,27 @@ public :
         if (boost::size(exceeding1) > 0)
         {
             // All exceeding from 1 with 2:
-            handle_two(collection1, exceeding1, collection2, exceeding2,
-                        policy);
-
             // All exceeding from 1 with lower and upper of 2:
-            handle_two(collection1, exceeding1, collection2, lower2, policy);
-            handle_two(collection1, exceeding1, collection2, upper2, policy);
+            if (! handle_two(collection1, exceeding1, collection2, exceeding2, policy)
+                || ! handle_two(collection1, exceeding1, collection2, lower2, policy)
+                || ! handle_two(collection1, exceeding1, collection2, upper2, policy))
+            {
+                return false;
+            }
         }
         if (boost::size(exceeding2) > 0)
         {
             // All exceeding from 2 with lower and upper of 1:
-            handle_two(collection1, lower1, collection2, exceeding2, policy);
-            handle_two(collection1, upper1, collection2, exceeding2, policy);
+            if (! handle_two(collection1, lower1, collection2, exceeding2, policy)
+                || ! handle_two(collection1, upper1, collection2, exceeding2, policy))
+            {
+                return false;
+            }
         }
 
-        next_level(lower_box, collection1, lower1, collection2, lower2, level,
-                        min_elements, policy, box_policy);
-        next_level(upper_box, collection1, upper1, collection2, upper2, level,
+        return next_level(lower_box, collection1, lower1, collection2, lower2, level,
+                        min_elements, policy, box_policy)
+            && next_level(upper_box, collection1, upper1, collection2, upper2, level,
                         min_elements, policy, box_policy);
     }
 };
@@ -322,6 +366,8 @@ struct visit_no_policy
     {}
 };
 
+// Calls the visitor for each pair of elements in overlapping partitions.
+// The visitor returns void, or bool: true to continue, or false to stop
 template
 <
     typename Box,
@@ -386,7 +432,10 @@ public :
                 iterator_type it2 = it1;
                 for(++it2; it2 != boost::end(collection); ++it2)
                 {
-                    visitor.apply(*it1, *it2);
+                    if (! detail::partition::visit(visitor, *it1, *it2))
+                    {
+                        return;
+                    }
                 }
             }
         }
@@ -440,7 +489,10 @@ public :
                     it2 != boost::end(collection2);
                     ++it2)
                 {
-                    visitor.apply(*it1, *it2);
+                    if (! detail::partition::visit(visitor, *it1, *it2))
+                    {
+                        return;
+                    }
                 }
             }
         }
@@ -22,6 +22,7 @@
 #include <boost/geometry/algorithms/detail/sub_range.hpp>
 #include <boost/geometry/algorithms/detail/single_geometry.hpp>
 
+#include <boost/geometry/algorithms/detail/relate/disjoint_envelopes.hpp>
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
@@ -38,13 +39,16 @@ namespace detail { namespace relate {
 // Use the rtree in this case!
 
 // may be used to set EI and EB for an Areal geometry for which no turns were generated
+// if the envelopes are disjoint, all areals are outside the other areal
 template <typename OtherAreal, typename Result, bool TransposeResult>
 class no_turns_aa_pred
 {
 public:
-    no_turns_aa_pred(OtherAreal const& other_areal, Result & res)
+    no_turns_aa_pred(OtherAreal const& other_areal, Result & res,
+                     bool disjoint_envelopes = false)
         : m_result(res)
         , m_other_areal(other_areal)
+        , m_disjoint_envelopes(disjoint_envelopes)
         , m_flags(0)
     {
         // check which relations must be analysed
@@ -85,7 +89,8 @@ public:
         // check if the areal is inside the other_areal
         // TODO: This is O(N)
         // Run in a loop O(NM) - optimize!
-        int pig = detail::within::point_in_geometry(pt, m_other_areal);
+        int pig = m_disjoint_envelopes ? -1
+                : detail::within::point_in_geometry(pt, m_other_areal);
         //BOOST_ASSERT( pig != 0 );
         
         // inside
@@ -138,7 +143,8 @@ public:
 
             // Check if any interior ring is inside
             ring_identifier ring_id(0, -1, 0);
-            int const irings_count = boost::numeric_cast<int>(
+            int const irings_count = m_disjoint_envelopes ? 0
+                                   : boost::numeric_cast<int>(
                                         geometry::num_interior_rings(areal) );
             for ( ; ring_id.ring_index < irings_count ; ++ring_id.ring_index )
             {
@@ -173,6 +179,7 @@ public:
 private:
     Result & m_result;
     OtherAreal const& m_other_areal;
+    bool const m_disjoint_envelopes;
     int m_flags;
 };
 
@@ -206,16 +213,21 @@ struct areal_areal
 
         interrupt_policy_areal_areal<Result> interrupt_policy(geometry1, geometry2, result);
 
-        turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy);
-        if ( result.interrupt )
-            return;
+        // if the envelopes are disjoint there are no turns
+        bool const disjoint = disjoint_envelopes(geometry1, geometry2);
+        if ( ! disjoint )
+        {
+            turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy);
+            if ( result.interrupt )
+                return;
+        }
 
-        no_turns_aa_pred<Geometry2, Result, false> pred1(geometry2, result);
+        no_turns_aa_pred<Geometry2, Result, false> pred1(geometry2, result, disjoint);
         for_each_disjoint_geometry_if<0, Geometry1>::apply(turns.begin(), turns.end(), geometry1, pred1);
         if ( result.interrupt )
             return;
 
-        no_turns_aa_pred<Geometry1, Result, true> pred2(geometry1, result);
+        no_turns_aa_pred<Geometry1, Result, true> pred2(geometry1, result, disjoint);
         for_each_disjoint_geometry_if<1, Geometry2>::apply(turns.begin(), turns.end(), geometry2, pred2);
         if ( result.interrupt )
             return;
@@ -0,0 +1,669 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_BOX_GEOMETRY_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_BOX_GEOMETRY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+#include <boost/geometry/multi/algorithms/envelope.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+#include <boost/geometry/algorithms/detail/relate/areal_areal.hpp>
+#include <boost/geometry/algorithms/detail/relate/less.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
+#include <boost/geometry/algorithms/detail/relate/result.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate {
+
+// NOTE: Boxes are expected to be valid, having min < max in both dimensions,
+// as other areal geometries are. Coordinates are compared using < and <=,
+// consistent with within(Point, Box) and covered_by(Point, Box).
+
+// Position of a point with respect to a box:
+// 1 in the interior, 0 on the boundary, -1 in the exterior
+template <typename Point, typename Box,
+          std::size_t I = 0,
+          std::size_t D = geometry::dimension<Box>::value>
+struct point_box_position
+{
+    static inline int apply(Point const& point, Box const& box)
+    {
+        if ( geometry::get<I>(point) < geometry::get<min_corner, I>(box)
+          || geometry::get<max_corner, I>(box) < geometry::get<I>(point) )
+        {
+            return -1;
+        }
+
+        int const next = point_box_position<Point, Box, I + 1, D>::apply(point, box);
+        if ( next < 0 )
+        {
+            return -1;
+        }
+
+        bool const on_bound = geometry::get<I>(point) == geometry::get<min_corner, I>(box)
+                           || geometry::get<I>(point) == geometry::get<max_corner, I>(box);
+        return on_bound ? 0 : next;
+    }
+};
+
+template <typename Point, typename Box, std::size_t D>
+struct point_box_position<Point, Box, D, D>
+{
+    static inline int apply(Point const&, Box const&)
+    {
+        return 1;
+    }
+};
+
+template <field F, bool Transpose, typename Result>
+inline void update_position(int position, Result & result)
+{
+    if ( position > 0 )
+        update<F, interior, '0', Transpose>(result);
+    else if ( position == 0 )
+        update<F, boundary, '0', Transpose>(result);
+    else
+        update<F, exterior, '0', Transpose>(result);
+}
+
+
+template <typename Point, typename Box, bool Transpose = false>
+struct point_box
+{
+    static const bool interruption_enabled = false;
+
+    template <typename Result>
+    static inline void apply(Point const& point, Box const& box, Result & result)
+    {
+        update_position<interior, Transpose>(
+            point_box_position<Point, Box>::apply(point, box), result);
+
+        set<exterior, interior, '2', Transpose>(result);
+        set<exterior, boundary, '1', Transpose>(result);
+        set<exterior, exterior, result_dimension<Point>::value, Transpose>(result);
+    }
+};
+
+// transposed result of point_box
+template <typename Box, typename Point>
+struct box_point
+{
+    static const bool interruption_enabled = false;
+
+    template <typename Result>
+    static inline void apply(Box const& box, Point const& point, Result & result)
+    {
+        point_box<Point, Box, true>::apply(point, box, result);
+    }
+};
+
+
+// The box boundary can never be covered by a finite number of points
+template <typename MultiPoint, typename Box, bool Transpose = false>
+struct multipoint_box
+{
+    static const bool interruption_enabled = true;
+
+    typedef typename boost::range_value<MultiPoint>::type point_type;
+
+    template <typename Result>
+    static inline void apply(MultiPoint const& multi_point, Box const& box, Result & result)
+    {
+        set<exterior, interior, '2', Transpose>(result);
+        set<exterior, boundary, '1', Transpose>(result);
+
+        if ( boost::empty(multi_point) )
+            return;
+
+        set<exterior, exterior, result_dimension<point_type>::value, Transpose>(result);
+
+        typedef typename boost::range_iterator<MultiPoint const>::type iterator;
+        for ( iterator it = boost::begin(multi_point) ;
+              it != boost::end(multi_point) && ! result.interrupt ; ++it )
+        {
+            update_position<interior, Transpose>(
+                point_box_position<point_type, Box>::apply(*it, box), result);
+        }
+    }
+};
+
+// transposed result of multipoint_box
+template <typename Box, typename MultiPoint>
+struct box_multipoint
+{
+    static const bool interruption_enabled = true;
+
+    template <typename Result>
+    static inline void apply(Box const& box, MultiPoint const& multi_point, Result & result)
+    {
+        multipoint_box<MultiPoint, Box, true>::apply(multi_point, box, result);
+    }
+};
+
+
+// Dimension of the intersection of two closed intervals:
+// -1 if they are disjoint, 0 if they share one value, 1 otherwise
+template <typename T>
+inline int intervals_intersection_dimension(T const& min1, T const& max1,
+                                            T const& min2, T const& max2)
+{
+    T const low = (std::max)(min1, min2);
+    T const high = (std::min)(max1, max2);
+    return high < low ? -1 : low < high ? 1 : 0;
+}
+
+// The DE-9IM matrix of two 2D boxes is derived from their intervals
+template <typename Box1, typename Box2>
+struct box_box
+{
+    static const bool interruption_enabled = false;
+
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Box1>::type,
+            typename coordinate_type<Box2>::type
+        >::type coordinate_type;
+
+    template <typename Result>
+    static inline void apply(Box1 const& box1, Box2 const& box2, Result & result)
+    {
+        coordinate_type const min_x1 = geometry::get<min_corner, 0>(box1);
+        coordinate_type const min_y1 = geometry::get<min_corner, 1>(box1);
+        coordinate_type const max_x1 = geometry::get<max_corner, 0>(box1);
+        coordinate_type const max_y1 = geometry::get<max_corner, 1>(box1);
+        coordinate_type const min_x2 = geometry::get<min_corner, 0>(box2);
+        coordinate_type const min_y2 = geometry::get<min_corner, 1>(box2);
+        coordinate_type const max_x2 = geometry::get<max_corner, 0>(box2);
+        coordinate_type const max_y2 = geometry::get<max_corner, 1>(box2);
+
+        set<exterior, exterior, result_dimension<Box1>::value>(result);
+
+        if ( max_x1 < min_x2 || max_x2 < min_x1
+          || max_y1 < min_y2 || max_y2 < min_y1 )
+        {
+            // disjoint
+            set<interior, exterior, '2'>(result);
+            set<boundary, exterior, '1'>(result);
+            set<exterior, interior, '2'>(result);
+            set<exterior, boundary, '1'>(result);
+            return;
+        }
+
+        bool const covered1 = min_x2 <= min_x1 && max_x1 <= max_x2
+                           && min_y2 <= min_y1 && max_y1 <= max_y2;
+        bool const covered2 = min_x1 <= min_x2 && max_x2 <= max_x1
+                           && min_y1 <= min_y2 && max_y2 <= max_y1;
+
+        // The interior of a box intersects the boundary of the other box
+        // if the interiors intersect and it is not covered by the other box
+        if ( min_x1 < max_x2 && min_x2 < max_x1
+          && min_y1 < max_y2 && min_y2 < max_y1 )
+        {
+            set<interior, interior, '2'>(result);
+            if ( ! covered1 )
+                set<interior, boundary, '1'>(result);
+            if ( ! covered2 )
+                set<boundary, interior, '1'>(result);
+        }
+
+        // A box is covered by a convex set iff its boundary is
+        if ( ! covered1 )
+        {
+            set<interior, exterior, '2'>(result);
+            set<boundary, exterior, '1'>(result);
+        }
+        if ( ! covered2 )
+        {
+            set<exterior, interior, '2'>(result);
+            set<exterior, boundary, '1'>(result);
+        }
+
+        int const bb = boundaries_intersection_dimension(
+                            min_x1, min_y1, max_x1, max_y1,
+                            min_x2, min_y2, max_x2, max_y2);
+        if ( bb == 1 )
+            set<boundary, boundary, '1'>(result);
+        else if ( bb == 0 )
+            set<boundary, boundary, '0'>(result);
+    }
+
+private:
+    // Intersects the four edges of both boxes, collinear edges may
+    // overlap, perpendicular edges may cross
+    static inline int boundaries_intersection_dimension(
+            coordinate_type const& min_x1, coordinate_type const& min_y1,
+            coordinate_type const& max_x1, coordinate_type const& max_y1,
+            coordinate_type const& min_x2, coordinate_type const& min_y2,
+            coordinate_type const& max_x2, coordinate_type const& max_y2)
+    {
+        coordinate_type const x1[2] = { min_x1, max_x1 };
+        coordinate_type const y1[2] = { min_y1, max_y1 };
+        coordinate_type const x2[2] = { min_x2, max_x2 };
+        coordinate_type const y2[2] = { min_y2, max_y2 };
+
+        int result = -1;
+        for ( int i = 0 ; i < 2 ; ++i )
+        {
+            for ( int j = 0 ; j < 2 ; ++j )
+            {
+                if ( x1[i] == x2[j] )
+                {
+                    result = (std::max)(result, intervals_intersection_dimension(
+                                            min_y1, max_y1, min_y2, max_y2));
+                }
+                if ( y1[i] == y2[j] )
+                {
+                    result = (std::max)(result, intervals_intersection_dimension(
+                                            min_x1, max_x1, min_x2, max_x2));
+                }
+                if ( ( min_x2 <= x1[i] && x1[i] <= max_x2
+                    && min_y1 <= y2[j] && y2[j] <= max_y1 )
+                  || ( min_x1 <= x2[j] && x2[j] <= max_x1
+                    && min_y2 <= y1[i] && y1[i] <= max_y2 ) )
+                {
+                    result = (std::max)(result, 0);
+                }
+            }
+        }
+        return result;
+    }
+};
+
+
+// Linear geometry and 2D box, analysed in one pass over the segments,
+// each segment is clipped by the box (Liang-Barsky)
+template <typename Linear, typename Box, bool Transpose = false>
+struct linear_box
+{
+    static const bool interruption_enabled = true;
+
+    typedef typename geometry::point_type<Linear>::type point_type;
+
+    typedef typename select_most_precise
+        <
+            typename select_most_precise
+                <
+                    typename coordinate_type<Linear>::type,
+                    typename coordinate_type<Box>::type
+                >::type,
+            double
+        >::type calculation_type;
+
+    typedef std::pair<calculation_type, calculation_type> interval_type;
+    typedef std::vector<point_type> boundary_type;
+
+    // Parts of the edges of the box covered by the linear geometry:
+    // x = min_x, x = max_x (y intervals), y = min_y, y = max_y (x intervals)
+    struct edges_coverage
+    {
+        std::vector<interval_type> intervals[4];
+
+        inline bool covers(Box const& box)
+        {
+            return covers(intervals[0], geometry::get<min_corner, 1>(box), geometry::get<max_corner, 1>(box))
+                && covers(intervals[1], geometry::get<min_corner, 1>(box), geometry::get<max_corner, 1>(box))
+                && covers(intervals[2], geometry::get<min_corner, 0>(box), geometry::get<max_corner, 0>(box))
+                && covers(intervals[3], geometry::get<min_corner, 0>(box), geometry::get<max_corner, 0>(box));
+        }
+
+        static inline bool covers(std::vector<interval_type> & edge,
+                                  calculation_type const& min_value,
+                                  calculation_type const& max_value)
+        {
+            std::sort(edge.begin(), edge.end());
+            calculation_type reached = min_value;
+            for ( typename std::vector<interval_type>::const_iterator it = edge.begin() ;
+                  it != edge.end() ; ++it )
+            {
+                if ( reached < it->first )
+                    return false;
+                reached = (std::max)(reached, it->second);
+            }
+            return ! (reached < max_value);
+        }
+    };
+
+    template <typename Result>
+    static inline void apply(Linear const& linear, Box const& box, Result & result)
+    {
+        set<exterior, interior, '2', Transpose>(result);
+        set<exterior, exterior, result_dimension<Box>::value, Transpose>(result);
+
+        if ( result.interrupt )
+            return;
+
+        boundary_type linear_boundary;
+        boundary_points<Linear>::apply(linear, linear_boundary);
+        std::sort(linear_boundary.begin(), linear_boundary.end(), less());
+
+        for ( typename boundary_type::const_iterator it = linear_boundary.begin() ;
+              it != linear_boundary.end() ; ++it )
+        {
+            update_position<boundary, Transpose>(
+                point_box_position<point_type, Box>::apply(*it, box), result);
+        }
+
+        if ( result.interrupt )
+            return;
+
+        edges_coverage coverage;
+        if ( ! apply_linestrings(linear, box, linear_boundary, coverage, result,
+                                 typename geometry::tag<Linear>::type()) )
+            return;
+
+        if ( ! coverage.covers(box) )
+            update<exterior, boundary, '1', Transpose>(result);
+    }
+
+private:
+    template <typename Result>
+    static inline bool apply_linestrings(Linear const& linear, Box const& box,
+                                         boundary_type const& linear_boundary,
+                                         edges_coverage & coverage,
+                                         Result & result,
+                                         linestring_tag)
+    {
+        return apply_linestring(linear, box, linear_boundary, coverage, result);
+    }
+
+    template <typename Result>
+    static inline bool apply_linestrings(Linear const& linear, Box const& box,
+                                         boundary_type const& linear_boundary,
+                                         edges_coverage & coverage,
+                                         Result & result,
+                                         multi_linestring_tag)
+    {
+        typedef typename boost::range_iterator<Linear const>::type iterator;
+        for ( iterator it = boost::begin(linear) ; it != boost::end(linear) ; ++it )
+        {
+            if ( ! apply_linestring(*it, box, linear_boundary, coverage, result) )
+                return false;
+        }
+        return true;
+    }
+
+    // Returns false if the result is interrupted
+    template <typename Linestring, typename Result>
+    static inline bool apply_linestring(Linestring const& linestring, Box const& box,
+                                        boundary_type const& linear_boundary,
+                                        edges_coverage & coverage,
+                                        Result & result)
+    {
+        typedef typename boost::range_iterator<Linestring const>::type iterator;
+
+        iterator const first = boost::begin(linestring);
+        iterator const last = boost::end(linestring);
+        iterator previous = first;
+        for ( iterator it = first ; it != last ; previous = it++ )
+        {
+            // Vertices equal to boundary points (not only the endpoints,
+            // in case of spikes) are handled by the caller
+            if ( linear_boundary.empty()
+              || ! std::binary_search(linear_boundary.begin(), linear_boundary.end(), *it, less()) )
+            {
+                update_position<interior, Transpose>(
+                    point_box_position<point_type, Box>::apply(*it, box), result);
+            }
+
+            if ( it != first )
+            {
+                apply_segment(*previous, *it, box, coverage, result);
+            }
+
+            if ( result.interrupt )
+                return false;
+        }
+        return true;
+    }
+
+    // The parts of the segment, its vertices are handled by the caller
+    template <typename Result>
+    static inline void apply_segment(point_type const& p, point_type const& q,
+                                     Box const& box,
+                                     edges_coverage & coverage,
+                                     Result & result)
+    {
+        calculation_type const px = geometry::get<0>(p);
+        calculation_type const py = geometry::get<1>(p);
+        calculation_type const qx = geometry::get<0>(q);
+        calculation_type const qy = geometry::get<1>(q);
+        calculation_type const min_x = geometry::get<min_corner, 0>(box);
+        calculation_type const min_y = geometry::get<min_corner, 1>(box);
+        calculation_type const max_x = geometry::get<max_corner, 0>(box);
+        calculation_type const max_y = geometry::get<max_corner, 1>(box);
+
+        if ( px == qx && py == qy )
+            return;
+
+        // Segments on the lines of the edges
+        if ( px == qx && (px == min_x || px == max_x) )
+        {
+            apply_collinear(py, qy, min_y, max_y,
+                            coverage.intervals[px == min_x ? 0 : 1], result);
+            return;
+        }
+        if ( py == qy && (py == min_y || py == max_y) )
+        {
+            apply_collinear(px, qx, min_x, max_x,
+                            coverage.intervals[py == min_y ? 2 : 3], result);
+            return;
+        }
+
+        calculation_type const dx = qx - px;
+        calculation_type const dy = qy - py;
+        calculation_type t0 = 0;
+        calculation_type t1 = 1;
+        if ( ! clip(-dx, px - min_x, t0, t1)
+          || ! clip(dx, max_x - px, t0, t1)
+          || ! clip(-dy, py - min_y, t0, t1)
+          || ! clip(dy, max_y - py, t0, t1) )
+        {
+            update<interior, exterior, '1', Transpose>(result);
+            return;
+        }
+
+        if ( t0 > 0 || t1 < 1 )
+            update<interior, exterior, '1', Transpose>(result);
+
+        // Not on an edge, so the open part of the clipped segment is in
+        // the interior of the box. Where it enters or leaves the box, the
+        // interior of the linear geometry intersects the boundary.
+        if ( t0 < t1 )
+            update<interior, interior, '1', Transpose>(result);
+        if ( (t0 > 0 && t0 < 1) || (t1 > 0 && t1 < 1) )
+            update<interior, boundary, '0', Transpose>(result);
+    }
+
+    template <typename Result>
+    static inline void apply_collinear(calculation_type const& v1,
+                                       calculation_type const& v2,
+                                       calculation_type const& min_value,
+                                       calculation_type const& max_value,
+                                       std::vector<interval_type> & edge,
+                                       Result & result)
+    {
+        calculation_type const low = (std::min)(v1, v2);
+        calculation_type const high = (std::max)(v1, v2);
+        if ( low < min_value || max_value < high )
+            update<interior, exterior, '1', Transpose>(result);
+
+        calculation_type const clipped_low = (std::max)(low, min_value);
+        calculation_type const clipped_high = (std::min)(high, max_value);
+        if ( clipped_low < clipped_high )
+        {
+            update<interior, boundary, '1', Transpose>(result);
+            edge.push_back(interval_type(clipped_low, clipped_high));
+        }
+    }
+
+    // Clips the parameter range [t0, t1] by the constraint p * t <= q
+    static inline bool clip(calculation_type const& p, calculation_type const& q,
+                            calculation_type & t0, calculation_type & t1)
+    {
+        if ( p == 0 )
+            return q >= 0;
+
+        calculation_type const r = q / p;
+        if ( p < 0 )
+        {
+            if ( r > t1 )
+                return false;
+            if ( r > t0 )
+                t0 = r;
+        }
+        else
+        {
+            if ( r < t0 )
+                return false;
+            if ( r < t1 )
+                t1 = r;
+        }
+        return true;
+    }
+};
+
+// transposed result of linear_box
+template <typename Box, typename Linear>
+struct box_linear
+{
+    static const bool interruption_enabled = true;
+
+    template <typename Result>
+    static inline void apply(Box const& box, Linear const& linear, Result & result)
+    {
+        linear_box<Linear, Box, true>::apply(linear, box, result);
+    }
+};
+
+
+// Areal geometry and box. If the envelope of the areal geometry is disjoint
+// from the box or within its interior, the result follows from the
+// envelope. Otherwise the box is converted to a ring.
+template <typename Areal, typename Box, bool Transpose = false>
+struct areal_box
+{
+    static const bool interruption_enabled = true;
+
+    typedef model::box<typename geometry::point_type<Areal>::type> envelope_type;
+    typedef model::ring<typename geometry::point_type<Box>::type> ring_type;
+
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Areal>::type,
+            typename coordinate_type<Box>::type
+        >::type coordinate_type;
+
+    template <typename Result>
+    static inline void apply(Areal const& areal, Box const& box, Result & result)
+    {
+        envelope_type envelope;
+        geometry::envelope(areal, envelope);
+
+        if ( geometry::get<max_corner, 0>(envelope) < geometry::get<min_corner, 0>(envelope) )
+        {
+            // empty
+            set<exterior, interior, '2', Transpose>(result);
+            set<exterior, boundary, '1', Transpose>(result);
+            set<exterior, exterior, result_dimension<Box>::value, Transpose>(result);
+            return;
+        }
+
+        coordinate_type const env_min_x = geometry::get<min_corner, 0>(envelope);
+        coordinate_type const env_min_y = geometry::get<min_corner, 1>(envelope);
+        coordinate_type const env_max_x = geometry::get<max_corner, 0>(envelope);
+        coordinate_type const env_max_y = geometry::get<max_corner, 1>(envelope);
+        coordinate_type const min_x = geometry::get<min_corner, 0>(box);
+        coordinate_type const min_y = geometry::get<min_corner, 1>(box);
+        coordinate_type const max_x = geometry::get<max_corner, 0>(box);
+        coordinate_type const max_y = geometry::get<max_corner, 1>(box);
+
+        if ( env_max_x < min_x || max_x < env_min_x
+          || env_max_y < min_y || max_y < env_min_y )
+        {
+            // disjoint
+            set<interior, exterior, '2', Transpose>(result);
+            set<boundary, exterior, '1', Transpose>(result);
+            set<exterior, interior, '2', Transpose>(result);
+            set<exterior, boundary, '1', Transpose>(result);
+            set<exterior, exterior, result_dimension<Box>::value, Transpose>(result);
+            return;
+        }
+
+        if ( min_x < env_min_x && env_max_x < max_x
+          && min_y < env_min_y && env_max_y < max_y )
+        {
+            // within the interior of the box, holes are in the exterior
+            // of the areal geometry and in the interior of the box
+            set<interior, interior, '2', Transpose>(result);
+            set<boundary, interior, '1', Transpose>(result);
+            set<exterior, interior, '2', Transpose>(result);
+            set<exterior, boundary, '1', Transpose>(result);
+            set<exterior, exterior, result_dimension<Box>::value, Transpose>(result);
+            return;
+        }
+
+        ring_type ring;
+        geometry::convert(box, ring);
+        apply_ring(areal, ring, result, boost::integral_constant<bool, Transpose>());
+    }
+
+private:
+    template <typename Result>
+    static inline void apply_ring(Areal const& areal, ring_type const& ring,
+                                  Result & result, boost::false_type)
+    {
+        areal_areal<Areal, ring_type>::apply(areal, ring, result);
+    }
+
+    template <typename Result>
+    static inline void apply_ring(Areal const& areal, ring_type const& ring,
+                                  Result & result, boost::true_type)
+    {
+        areal_areal<ring_type, Areal>::apply(ring, areal, result);
+    }
+};
+
+// transposed result of areal_box
+template <typename Box, typename Areal>
+struct box_areal
+{
+    static const bool interruption_enabled = true;
+
+    template <typename Result>
+    static inline void apply(Box const& box, Areal const& areal, Result & result)
+    {
+        areal_box<Areal, Box, true>::apply(areal, box, result);
+    }
+};
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_BOX_GEOMETRY_HPP
@@ -0,0 +1,51 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_DISJOINT_ENVELOPES_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_DISJOINT_ENVELOPES_HPP
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/multi/algorithms/envelope.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate {
+
+/*!
+\brief Internal, returns true if the envelopes of two geometries do not
+    intersect, such that the geometries have no turns and the interior and
+    boundary of each geometry is in the exterior of the other geometry
+\note The envelope of an empty geometry is disjoint from any envelope
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool disjoint_envelopes(Geometry1 const& geometry1,
+                               Geometry2 const& geometry2)
+{
+    typedef model::box<typename geometry::point_type<Geometry1>::type> box1_type;
+    typedef model::box<typename geometry::point_type<Geometry2>::type> box2_type;
+
+    box1_type box1;
+    box2_type box2;
+    geometry::envelope(geometry1, box1);
+    geometry::envelope(geometry2, box2);
+
+    return detail::disjoint::disjoint_box_box(box1, box2);
+}
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_DISJOINT_ENVELOPES_HPP
@@ -22,6 +22,7 @@
 #include <boost/geometry/algorithms/detail/sub_range.hpp>
 #include <boost/geometry/algorithms/detail/single_geometry.hpp>
 
+#include <boost/geometry/algorithms/detail/relate/disjoint_envelopes.hpp>
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
@@ -40,16 +41,19 @@ namespace detail { namespace relate {
 // Use the rtree in this case!
 
 // may be used to set IE and BE for a Linear geometry for which no turns were generated
+// if the envelopes are disjoint, all linestrings are outside the areal
 template <typename Geometry2, typename Result, typename BoundaryChecker, bool TransposeResult>
 class no_turns_la_linestring_pred
 {
 public:
     no_turns_la_linestring_pred(Geometry2 const& geometry2,
                                 Result & res,
-                                BoundaryChecker const& boundary_checker)
+                                BoundaryChecker const& boundary_checker,
+                                bool disjoint_envelopes = false)
         : m_geometry2(geometry2)
         , m_result(res)
         , m_boundary_checker(boundary_checker)
+        , m_disjoint_envelopes(disjoint_envelopes)
         , m_interrupt_flags(0)
     {
         if ( ! may_update<interior, interior, '1', TransposeResult>(m_result) )
@@ -92,7 +96,8 @@ public:
             return false;
         }
 
-        int pig = detail::within::point_in_geometry(range::front(linestring), m_geometry2);
+        int pig = m_disjoint_envelopes ? -1
+                : detail::within::point_in_geometry(range::front(linestring), m_geometry2);
         //BOOST_ASSERT_MSG(pig != 0, "There should be no IPs");
 
         if ( pig > 0 )
@@ -133,6 +138,7 @@ private:
     Geometry2 const& m_geometry2;
     Result & m_result;
     BoundaryChecker const& m_boundary_checker;
+    bool const m_disjoint_envelopes;
     unsigned m_interrupt_flags;
 };
 
@@ -209,9 +215,14 @@ struct linear_areal
 
         interrupt_policy_linear_areal<Geometry2, Result> interrupt_policy(geometry2, result);
 
-        turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy);
-        if ( result.interrupt )
-            return;
+        // if the envelopes are disjoint there are no turns
+        bool const disjoint = disjoint_envelopes(geometry1, geometry2);
+        if ( ! disjoint )
+        {
+            turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy);
+            if ( result.interrupt )
+                return;
+        }
 
         boundary_checker<Geometry1> boundary_checker1(geometry1);
         no_turns_la_linestring_pred
@@ -220,7 +231,7 @@ struct linear_areal
                 Result,
                 boundary_checker<Geometry1>,
                 TransposeResult
-            > pred1(geometry2, result, boundary_checker1);
+            > pred1(geometry2, result, boundary_checker1, disjoint);
         for_each_disjoint_geometry_if<0, Geometry1>::apply(turns.begin(), turns.end(), geometry1, pred1);
         if ( result.interrupt )
             return;
@@ -14,11 +14,19 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_GEOMETRY_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_GEOMETRY_HPP
 
+#include <algorithm>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/algorithms/detail/within/multi_point_in_geometry.hpp>
 #include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
 //#include <boost/geometry/algorithms/within.hpp>
 //#include <boost/geometry/algorithms/covered_by.hpp>
 
+#include <boost/geometry/algorithms/detail/relate/less.hpp>
 #include <boost/geometry/algorithms/detail/relate/topology_check.hpp>
+#include <boost/geometry/util/range.hpp>
 
 namespace boost { namespace geometry
 {
@@ -99,103 +107,193 @@ struct geometry_point
     }
 };
 
-// TODO: rewrite the folowing:
-
-//// NOTE: Those tests should be consistent with within(Point, Box) and covered_by(Point, Box)
-//// There is no EPS used in those functions, values are compared using < or <=
-//// so comparing MIN and MAX in the same way should be fine
-//
-//template <typename Box, std::size_t I = 0, std::size_t D = geometry::dimension<Box>::value>
-//struct box_has_interior
-//{
-//    static inline bool apply(Box const& box)
-//    {
-//        return geometry::get<min_corner, I>(box) < geometry::get<max_corner, I>(box)
-//            && box_has_interior<Box, I + 1, D>::apply(box);
-//    }
-//};
-//
-//template <typename Box, std::size_t D>
-//struct box_has_interior<Box, D, D>
-//{
-//    static inline bool apply(Box const&) { return true; }
-//};
-//
-//// NOTE: especially important here (see the NOTE above).
-//
-//template <typename Box, std::size_t I = 0, std::size_t D = geometry::dimension<Box>::value>
-//struct box_has_equal_min_max
-//{
-//    static inline bool apply(Box const& box)
-//    {
-//        return geometry::get<min_corner, I>(box) == geometry::get<max_corner, I>(box)
-//            && box_has_equal_min_max<Box, I + 1, D>::apply(box);
-//    }
-//};
-//
-//template <typename Box, std::size_t D>
-//struct box_has_equal_min_max<Box, D, D>
-//{
-//    static inline bool apply(Box const&) { return true; }
-//};
-//
-//template <typename Point, typename Box>
-//struct point_box
-//{
-//    static inline result apply(Point const& point, Box const& box)
-//    {
-//        result res;
-//
-//        if ( geometry::within(point, box) ) // this also means that the box has interior
-//        {
-//            return result("0FFFFFTTT");
-//        }
-//        else if ( geometry::covered_by(point, box) ) // point is on the boundary
-//        {
-//            //if ( box_has_interior<Box>::apply(box) )
-//            //{
-//            //    return result("F0FFFFTTT");
-//            //}
-//            //else if ( box_has_equal_min_max<Box>::apply(box) ) // no boundary outside point
-//            //{
-//            //    return result("F0FFFFFFT");
-//            //}
-//            //else // no interior outside point
-//            //{
-//            //    return result("F0FFFFFTT");
-//            //}
-//            return result("F0FFFF**T");
-//        }
-//        else 
-//        {
-//            /*if ( box_has_interior<Box>::apply(box) )
-//            {
-//                return result("FF0FFFTTT");
-//            }
-//            else
-//            {
-//                return result("FF0FFFFTT");
-//            }*/
-//            return result("FF0FFF*TT");
-//        }
-//
-//        return res;
-//    }
-//};
-//
-//template <typename Box, typename Point>
-//struct box_point
-//{
-//    static inline result apply(Box const& box, Point const& point)
-//    {
-//        if ( geometry::within(point, box) )
-//            return result("0FTFFTFFT");
-//        else if ( geometry::covered_by(point, box) )
-//            return result("FF*0F*FFT");
-//        else 
-//            return result("FF*FFT0FT");
-//    }
-//};
+// Collects the boundary points of a linear geometry (mod-2 rule)
+template <typename Geometry,
+          typename Tag = typename geometry::tag<Geometry>::type>
+struct boundary_points
+{
+    template <typename Points>
+    static inline void apply(Geometry const&, Points&)
+    {}
+};
+
+template <typename Linestring>
+struct boundary_points<Linestring, linestring_tag>
+{
+    template <typename Points>
+    static inline void apply(Linestring const& linestring, Points& points)
+    {
+        if ( boost::size(linestring) > 1
+          && ! detail::equals::equals_point_point(range::front(linestring),
+                                                  range::back(linestring)) )
+        {
+            points.push_back(range::front(linestring));
+            points.push_back(range::back(linestring));
+        }
+    }
+};
+
+template <typename MultiLinestring>
+struct boundary_points<MultiLinestring, multi_linestring_tag>
+{
+    template <typename Points>
+    static inline void apply(MultiLinestring const& multi_linestring, Points& points)
+    {
+        typedef typename boost::range_value<MultiLinestring>::type linestring_type;
+
+        Points endpoints;
+        typedef typename boost::range_iterator<MultiLinestring const>::type iterator;
+        for ( iterator it = boost::begin(multi_linestring) ;
+              it != boost::end(multi_linestring) ; ++it )
+        {
+            boundary_points<linestring_type>::apply(*it, endpoints);
+        }
+
+        // Endpoints occurring an odd number of times are boundary points
+        std::sort(endpoints.begin(), endpoints.end(), less());
+        typename Points::const_iterator it = endpoints.begin();
+        while ( it != endpoints.end() )
+        {
+            typename Points::const_iterator next = it + 1;
+            while ( next != endpoints.end()
+                 && detail::equals::equals_point_point(*it, *next) )
+            {
+                ++next;
+            }
+            if ( (next - it) % 2 != 0 )
+            {
+                points.push_back(*it);
+            }
+            it = next;
+        }
+    }
+};
+
+// MultiPoint and non-point geometry, the points are classified in a batch
+template <typename MultiPoint, typename Geometry, bool Transpose = false>
+struct multipoint_geometry
+{
+    static const bool interruption_enabled = true;
+
+    typedef typename boost::range_value<MultiPoint>::type point_type;
+    typedef detail::relate::topology_check<Geometry> tc_t;
+
+    template <typename Result>
+    static inline void apply(MultiPoint const& multi_point, Geometry const& geometry, Result & result)
+    {
+        if ( boost::empty(multi_point) )
+        {
+            set_geometry_exterior(multi_point, geometry, std::vector<int>(), result);
+            return;
+        }
+
+        detail::within::multi_point_in_geometry<MultiPoint, Geometry>
+            classifier(multi_point, geometry);
+
+        // Points outside the envelope are found without classifying
+        // the other points, which is not necessary for e.g. within
+        if ( classifier.outside_envelope_count() > 0 )
+        {
+            set<interior, exterior, '0', Transpose>(result);
+            if ( result.interrupt )
+                return;
+        }
+
+        std::vector<int> const& codes = classifier.classify();
+
+        bool found[3] = { false, false, false };
+        for ( std::vector<int>::const_iterator it = codes.begin() ;
+              it != codes.end() ; ++it )
+        {
+            found[*it + 1] = true;
+        }
+
+        if ( found[2] ) // within
+            set<interior, interior, '0', Transpose>(result);
+        if ( found[1] )
+            set<interior, boundary, '0', Transpose>(result);
+        if ( found[0] ) // not within
+            set<interior, exterior, '0', Transpose>(result);
+
+        set<exterior, exterior, result_dimension<point_type>::value, Transpose>(result);
+
+        if ( result.interrupt )
+            return;
+
+        set_geometry_exterior(multi_point, geometry, codes, result);
+    }
+
+private :
+
+    // The interior and boundary of the geometry, as far as not covered
+    // by the points
+    template <typename Result>
+    static inline void set_geometry_exterior(MultiPoint const& multi_point,
+                                             Geometry const& geometry,
+                                             std::vector<int> const& codes,
+                                             Result & result)
+    {
+        tc_t tc(geometry);
+        if ( tc.has_interior )
+            set<exterior, interior, tc_t::interior, Transpose>(result);
+        if ( tc.has_boundary && ! boundary_covered(multi_point, geometry, codes) )
+            set<exterior, boundary, tc_t::boundary, Transpose>(result);
+    }
+
+    // Returns true if the boundary of the geometry is a set of points
+    // which are all equal to points on the boundary
+    static inline bool boundary_covered(MultiPoint const& multi_point,
+                                        Geometry const& geometry,
+                                        std::vector<int> const& codes)
+    {
+        if ( tc_t::boundary != '0' )
+        {
+            return false;
+        }
+
+        std::vector<point_type> points;
+        std::size_t i = 0;
+        typedef typename boost::range_iterator<MultiPoint const>::type iterator;
+        for ( iterator it = boost::begin(multi_point) ;
+              it != boost::end(multi_point) ; ++it, ++i )
+        {
+            if ( codes[i] == 0 )
+            {
+                points.push_back(*it);
+            }
+        }
+        if ( points.empty() )
+        {
+            return false;
+        }
+        std::sort(points.begin(), points.end(), less());
+
+        std::vector<typename geometry::point_type<Geometry>::type> boundary;
+        boundary_points<Geometry>::apply(geometry, boundary);
+        for ( std::size_t j = 0 ; j < boundary.size() ; ++j )
+        {
+            if ( ! std::binary_search(points.begin(), points.end(),
+                                      boundary[j], less()) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// transposed result of multipoint_geometry
+template <typename Geometry, typename MultiPoint>
+struct geometry_multipoint
+{
+    static const bool interruption_enabled = true;
+
+    template <typename Result>
+    static inline void apply(Geometry const& geometry, MultiPoint const& multi_point, Result & result)
+    {
+        multipoint_geometry<MultiPoint, Geometry, true>::apply(multi_point, geometry, result);
+    }
+};
 
 }} // namespace detail::relate
 #endif // DOXYGEN_NO_DETAIL
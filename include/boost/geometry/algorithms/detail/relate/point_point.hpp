@@ -17,6 +17,7 @@
 #include <boost/geometry/algorithms/detail/equals/point_point.hpp>
 #include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
 #include <boost/geometry/algorithms/detail/relate/less.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_set.hpp>
 
 namespace boost { namespace geometry
 {
@@ -177,10 +178,13 @@ struct multipoint_multipoint
                               IteratedMultiPoint const& iterated_mpt,
                               Result & result)
     {
-        // sort points from the 1 MPt
+        // sort or hash points from the 1 MPt
         typedef typename geometry::point_type<SortedMultiPoint>::type point_type;
-        std::vector<point_type> points(boost::begin(sorted_mpt), boost::end(sorted_mpt));
-        std::sort(points.begin(), points.end(), less());
+        point_set
+            <
+                point_type,
+                typename geometry::point_type<IteratedMultiPoint>::type
+            > const points(sorted_mpt);
 
         bool found_inside = false;
         bool found_outside = false;
@@ -190,7 +194,7 @@ struct multipoint_multipoint
         for ( iterator it = boost::begin(iterated_mpt) ;
               it != boost::end(iterated_mpt) ; ++it )
         {
-            bool ii = binary_search(points.begin(), points.end(), *it, less());
+            bool ii = points.contains(*it);
             if ( ii )
                 found_inside = true;
             else
@@ -0,0 +1,194 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_SET_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_SET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/unordered_set.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+
+#include <boost/geometry/algorithms/detail/relate/less.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate {
+
+
+// Points can be hashed if their coordinates are compared exactly, which is
+// the case for integral coordinates. If Exact is true, all coordinates are
+// hashed and compared exactly: floating point points differing less than
+// epsilon are then considered as different.
+template <typename Point1, typename Point2, bool Exact = false>
+struct use_point_hash
+{
+    typedef typename geometry::coordinate_type<Point1>::type coordinate1_type;
+    typedef typename geometry::coordinate_type<Point2>::type coordinate2_type;
+
+    static const bool value
+        = boost::is_same<coordinate1_type, coordinate2_type>::value
+       && (Exact || boost::is_integral<coordinate1_type>::value);
+};
+
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Point>::value
+>
+struct hash_coordinates
+{
+    static inline void apply(Point const& point, std::size_t& seed)
+    {
+        typename geometry::coordinate_type<Point>::type
+            value = geometry::get<Dimension>(point);
+
+        // Such that -0.0 and 0.0 get the same hash
+        if ( value == 0 )
+        {
+            value = 0;
+        }
+
+        boost::hash_combine(seed, value);
+        hash_coordinates<Point, Dimension + 1, DimensionCount>::apply(point, seed);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct hash_coordinates<Point, DimensionCount, DimensionCount>
+{
+    static inline void apply(Point const&, std::size_t&)
+    {}
+};
+
+struct point_hash
+{
+    template <typename Point>
+    inline std::size_t operator()(Point const& point) const
+    {
+        std::size_t seed = 0;
+        hash_coordinates<Point>::apply(point, seed);
+        return seed;
+    }
+};
+
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Point>::value
+>
+struct equal_coordinates
+{
+    static inline bool apply(Point const& point1, Point const& point2)
+    {
+        return geometry::get<Dimension>(point1) == geometry::get<Dimension>(point2)
+            && equal_coordinates<Point, Dimension + 1, DimensionCount>::apply(point1, point2);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct equal_coordinates<Point, DimensionCount, DimensionCount>
+{
+    static inline bool apply(Point const&, Point const&)
+    {
+        return true;
+    }
+};
+
+struct point_equal_to
+{
+    template <typename Point>
+    inline bool operator()(Point const& point1, Point const& point2) const
+    {
+        return equal_coordinates<Point>::apply(point1, point2);
+    }
+};
+
+
+/*!
+\brief Internal, set of the points of a multi-point, to find points equal to
+    the points of another pointlike geometry
+\details By default the points are sorted and searched for in O(log(N)).
+    Points with exactly compared coordinates (see use_point_hash) are
+    hashed and searched for in constant expected time, such that set
+    operations of large multi-points take linear expected time.
+\tparam Exact if true, floating point coordinates are compared exactly as
+    well, and hashed. By default they are compared as equals does.
+*/
+template
+<
+    typename Point,
+    typename OtherPoint,
+    bool Exact = false,
+    bool Hash = use_point_hash<Point, OtherPoint, Exact>::value
+>
+class point_set
+{
+public :
+    template <typename MultiPoint>
+    explicit inline point_set(MultiPoint const& multi_point)
+        : m_points(boost::begin(multi_point), boost::end(multi_point))
+    {
+        std::sort(m_points.begin(), m_points.end(), less());
+    }
+
+    inline bool contains(OtherPoint const& point) const
+    {
+        return std::binary_search(m_points.begin(), m_points.end(),
+                                  point, less());
+    }
+
+private :
+    std::vector<Point> m_points;
+};
+
+template <typename Point, typename OtherPoint, bool Exact>
+class point_set<Point, OtherPoint, Exact, true>
+{
+public :
+    template <typename MultiPoint>
+    explicit inline point_set(MultiPoint const& multi_point)
+        : m_points(boost::begin(multi_point), boost::end(multi_point),
+                   boost::size(multi_point))
+    {}
+
+    inline bool contains(OtherPoint const& other) const
+    {
+        Point point;
+        geometry::convert(other, point);
+        return m_points.find(point) != m_points.end();
+    }
+
+private :
+    boost::unordered_set<Point, point_hash, point_equal_to> m_points;
+};
+
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_SET_HPP
@@ -52,6 +52,7 @@
 #include <boost/geometry/algorithms/detail/relate/linear_linear.hpp>
 #include <boost/geometry/algorithms/detail/relate/linear_areal.hpp>
 #include <boost/geometry/algorithms/detail/relate/areal_areal.hpp>
+#include <boost/geometry/algorithms/detail/relate/box_geometry.hpp>
 
 namespace boost { namespace geometry
 {
@@ -102,6 +103,36 @@ struct is_generic<Point1, Point2, point_tag, point_tag>
     static const bool value = false;
 };
 
+template <typename MultiPoint, typename Geometry, typename Tag>
+struct is_generic<MultiPoint, Geometry, multi_point_tag, Tag>
+{
+    static const bool value = is_supported_by_generic<Geometry>::value;
+};
+
+template <typename Geometry, typename MultiPoint, typename Tag>
+struct is_generic<Geometry, MultiPoint, Tag, multi_point_tag>
+{
+    static const bool value = is_supported_by_generic<Geometry>::value;
+};
+
+template <typename Point, typename MultiPoint>
+struct is_generic<Point, MultiPoint, point_tag, multi_point_tag>
+{
+    static const bool value = false;
+};
+
+template <typename MultiPoint, typename Point>
+struct is_generic<MultiPoint, Point, multi_point_tag, point_tag>
+{
+    static const bool value = false;
+};
+
+template <typename MultiPoint1, typename MultiPoint2>
+struct is_generic<MultiPoint1, MultiPoint2, multi_point_tag, multi_point_tag>
+{
+    static const bool value = false;
+};
+
 
 }} // namespace detail::relate
 
@@ -141,15 +172,60 @@ struct relate<MultiPoint1, MultiPoint2, multi_point_tag, multi_point_tag, 0, 0,
     : detail::relate::multipoint_multipoint<MultiPoint1, MultiPoint2>
 {};
 
-//template <typename Point, typename Box, int TopDim2>
-//struct relate<Point, Box, point_tag, box_tag, 0, TopDim2, false>
-//    : detail::relate::point_box<Point, Box>
-//{};
-//
-//template <typename Box, typename Point, int TopDim1>
-//struct relate<Box, Point, box_tag, point_tag, TopDim1, 0, false>
-//    : detail::relate::box_point<Box, Point>
-//{};
+template <typename Point, typename Box>
+struct relate<Point, Box, point_tag, box_tag, 0, 2, false>
+    : detail::relate::point_box<Point, Box>
+{};
+
+template <typename Box, typename Point>
+struct relate<Box, Point, box_tag, point_tag, 2, 0, false>
+    : detail::relate::box_point<Box, Point>
+{};
+
+template <typename MultiPoint, typename Box>
+struct relate<MultiPoint, Box, multi_point_tag, box_tag, 0, 2, false>
+    : detail::relate::multipoint_box<MultiPoint, Box>
+{};
+
+template <typename Box, typename MultiPoint>
+struct relate<Box, MultiPoint, box_tag, multi_point_tag, 2, 0, false>
+    : detail::relate::box_multipoint<Box, MultiPoint>
+{};
+
+template <typename Linestring, typename Box>
+struct relate<Linestring, Box, linestring_tag, box_tag, 1, 2, false>
+    : detail::relate::linear_box<Linestring, Box>
+{};
+
+template <typename MultiLinestring, typename Box>
+struct relate<MultiLinestring, Box, multi_linestring_tag, box_tag, 1, 2, false>
+    : detail::relate::linear_box<MultiLinestring, Box>
+{};
+
+template <typename Box, typename Linestring>
+struct relate<Box, Linestring, box_tag, linestring_tag, 2, 1, false>
+    : detail::relate::box_linear<Box, Linestring>
+{};
+
+template <typename Box, typename MultiLinestring>
+struct relate<Box, MultiLinestring, box_tag, multi_linestring_tag, 2, 1, false>
+    : detail::relate::box_linear<Box, MultiLinestring>
+{};
+
+template <typename Areal, typename Box, typename Tag1>
+struct relate<Areal, Box, Tag1, box_tag, 2, 2, false>
+    : detail::relate::areal_box<Areal, Box>
+{};
+
+template <typename Box, typename Areal, typename Tag2>
+struct relate<Box, Areal, box_tag, Tag2, 2, 2, false>
+    : detail::relate::box_areal<Box, Areal>
+{};
+
+template <typename Box1, typename Box2>
+struct relate<Box1, Box2, box_tag, box_tag, 2, 2, false>
+    : detail::relate::box_box<Box1, Box2>
+{};
 
 
 template <typename Point, typename Geometry, typename Tag2, int TopDim2>
@@ -162,6 +238,16 @@ struct relate<Geometry, Point, Tag1, point_tag, TopDim1, 0, true>
     : detail::relate::geometry_point<Geometry, Point>
 {};
 
+template <typename MultiPoint, typename Geometry, typename Tag2, int TopDim2>
+struct relate<MultiPoint, Geometry, multi_point_tag, Tag2, 0, TopDim2, true>
+    : detail::relate::multipoint_geometry<MultiPoint, Geometry>
+{};
+
+template <typename Geometry, typename MultiPoint, typename Tag1, int TopDim1>
+struct relate<Geometry, MultiPoint, Tag1, multi_point_tag, TopDim1, 0, true>
+    : detail::relate::geometry_multipoint<Geometry, MultiPoint>
+{};
+
 
 template <typename Linear1, typename Linear2, typename Tag1, typename Tag2>
 struct relate<Linear1, Linear2, Tag1, Tag2, 1, 1, true>
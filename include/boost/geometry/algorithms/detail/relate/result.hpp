@@ -977,6 +977,50 @@ struct static_check
     }
 };
 
+// static_positive_decision
+
+// A mask containing only 'T' and '*' elements is fulfilled as soon as all its
+// 'T' elements are set, because the elements of the matrix are only
+// increased. Then the analysis may be interrupted with a positive result.
+template <typename StaticMask, bool IsSequence>
+struct static_positive_decision_dispatch
+{
+    template <field F1, field F2>
+    struct per_one
+    {
+        static const char mask_el = StaticMask::template get<F1, F2>::value;
+        static const bool value = mask_el == 'T' || mask_el == '*';
+    };
+
+    static const bool value
+        = per_one<interior, interior>::value
+       && per_one<interior, boundary>::value
+       && per_one<interior, exterior>::value
+       && per_one<boundary, interior>::value
+       && per_one<boundary, boundary>::value
+       && per_one<boundary, exterior>::value
+       && per_one<exterior, interior>::value
+       && per_one<exterior, boundary>::value
+       && per_one<exterior, exterior>::value;
+};
+
+template <typename StaticMask>
+struct static_positive_decision_dispatch<StaticMask, true>
+{
+    static const bool value = false;
+};
+
+template <typename StaticMask>
+struct static_positive_decision
+{
+    static const bool value
+        = static_positive_decision_dispatch
+            <
+                StaticMask,
+                boost::mpl::is_sequence<StaticMask>::value
+            >::value;
+};
+
 // static_mask_handler
 
 template <typename StaticMask, bool Interrupt>
@@ -985,6 +1029,11 @@ class static_mask_handler
 {
     typedef matrix<3> base_t;
 
+    // If the mask may be decided positively, the analysis is interrupted
+    // when it is fulfilled, and never because it is violated
+    static const bool positive_decision
+        = Interrupt && static_positive_decision<StaticMask>::value;
+
 public:
     typedef bool result_type;
 
@@ -996,7 +1045,7 @@ public:
 
     result_type result() const
     {
-        return (!Interrupt || !interrupt)
+        return (!Interrupt || positive_decision || !interrupt)
             && static_check<StaticMask>::
                     apply(static_cast<base_t const&>(*this));
     }
@@ -1056,6 +1105,7 @@ private:
     inline void set_dispatch(integral_constant<int, 1>)
     {
         base_t::template set<F1, F2, V>();
+        decide(integral_constant<bool, positive_decision>());
     }
     // else
     template <field F1, field F2, char V>
@@ -1073,11 +1123,24 @@ private:
     inline void update_dispatch(integral_constant<int, 1>)
     {
         base_t::template update<F1, F2, V>();
+        decide(integral_constant<bool, positive_decision>());
     }
     // else
     template <field F1, field F2, char V>
     inline void update_dispatch(integral_constant<int, 2>)
     {}
+
+    // positive_decision
+    inline void decide(integral_constant<bool, true>)
+    {
+        if ( static_check<StaticMask>::apply(static_cast<base_t const&>(*this)) )
+        {
+            interrupt = true;
+        }
+    }
+    // else
+    inline void decide(integral_constant<bool, false>)
+    {}
 };
 
 // OPERATORS
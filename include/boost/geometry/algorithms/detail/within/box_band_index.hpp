@@ -0,0 +1,214 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_BOX_BAND_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_BOX_BAND_INDEX_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/util/promote_floating_point.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within
+{
+
+
+/*!
+\brief Index of the envelopes of the members of a multi-geometry, divided
+    into horizontal bands
+\details A point can only be in a member if it is in the envelope of that
+    member. As ring_band_index does for segments, the index divides the
+    y-range of all envelopes into bands and registers each envelope in the
+    bands it spans. A point is only compared with the envelopes of its band,
+    in the order in which they were added, instead of with all envelopes.
+*/
+template <typename Box>
+class box_band_index
+{
+    typedef typename promote_floating_point
+        <
+            typename geometry::coordinate_type<Box>::type
+        >::type calculation_type;
+
+    // Maximum average number of registrations per envelope
+    static const std::size_t max_registrations = 8;
+
+    struct entry
+    {
+        Box box;
+        std::size_t id;
+    };
+
+public :
+    inline box_band_index()
+        : m_band_count(0)
+        , m_min_y(0)
+        , m_band_height(1)
+    {
+        geometry::assign_inverse(m_envelope);
+    }
+
+    //! Adds the envelope of member id, before build is called
+    inline void add(Box const& box, std::size_t id)
+    {
+        entry e;
+        e.box = box;
+        e.id = id;
+        m_entries.push_back(e);
+        geometry::expand(m_envelope, box);
+    }
+
+    //! Registers the envelopes in the bands
+    inline void build()
+    {
+        std::size_t const count = m_entries.size();
+        if (count == 0)
+        {
+            return;
+        }
+
+        m_min_y = get<min_corner, 1>(m_envelope);
+        calculation_type const height
+            = calculation_type(get<max_corner, 1>(m_envelope)) - m_min_y;
+
+        // Start with as many bands as envelopes, and halve that until the
+        // registrations fit
+        m_band_count = count;
+        std::size_t registrations = 0;
+        while (true)
+        {
+            m_band_height = m_band_count > 1 && height > 0
+                ? height / calculation_type(m_band_count)
+                : calculation_type(1);
+
+            registrations = 0;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                registrations += last_band(i) - first_band(i) + 1;
+            }
+
+            if (m_band_count <= 1
+                || registrations <= max_registrations * count)
+            {
+                break;
+            }
+            m_band_count /= 2;
+        }
+
+        // Fill the bands, stored consecutively (compressed rows)
+        m_offsets.assign(m_band_count + 1, 0);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            for (std::size_t b = first_band(i); b <= last_band(i); b++)
+            {
+                m_offsets[b + 1]++;
+            }
+        }
+        for (std::size_t b = 0; b < m_band_count; b++)
+        {
+            m_offsets[b + 1] += m_offsets[b];
+        }
+
+        m_registrations.resize(registrations);
+        std::vector<std::size_t> position(m_offsets.begin(), m_offsets.end() - 1);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            for (std::size_t b = first_band(i); b <= last_band(i); b++)
+            {
+                m_registrations[position[b]++] = i;
+            }
+        }
+    }
+
+    /*!
+    \brief Calls visitor(id) for the members whose envelope contains the
+        point, in the order in which they were added, as long as it
+        returns true
+    \return false if the visitor stopped the iteration
+    */
+    template <typename Point, typename Visitor>
+    inline bool apply(Point const& point, Visitor& visitor) const
+    {
+        if (m_band_count == 0 || ! contains(m_envelope, point))
+        {
+            return true;
+        }
+
+        std::size_t const band = band_of(get<1>(point));
+        for (std::size_t i = m_offsets[band]; i < m_offsets[band + 1]; i++)
+        {
+            entry const& e = m_entries[m_registrations[i]];
+            if (contains(e.box, point) && ! visitor(e.id))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private :
+    template <typename Point>
+    static inline bool contains(Box const& box, Point const& point)
+    {
+        return get<0>(point) >= get<min_corner, 0>(box)
+            && get<0>(point) <= get<max_corner, 0>(box)
+            && get<1>(point) >= get<min_corner, 1>(box)
+            && get<1>(point) <= get<max_corner, 1>(box);
+    }
+
+    template <typename T>
+    inline std::size_t band_of(T const& y) const
+    {
+        calculation_type const b = (calculation_type(y) - m_min_y) / m_band_height;
+        if (b <= 0)
+        {
+            return 0;
+        }
+        std::size_t const result = static_cast<std::size_t>(b);
+        return result >= m_band_count ? m_band_count - 1 : result;
+    }
+
+    inline std::size_t first_band(std::size_t index) const
+    {
+        return band_of(get<min_corner, 1>(m_entries[index].box));
+    }
+
+    inline std::size_t last_band(std::size_t index) const
+    {
+        return band_of(get<max_corner, 1>(m_entries[index].box));
+    }
+
+    std::vector<entry> m_entries;
+    Box m_envelope;
+
+    std::size_t m_band_count;
+    calculation_type m_min_y;
+    calculation_type m_band_height;
+
+    std::vector<std::size_t> m_offsets;
+    std::vector<std::size_t> m_registrations;
+};
+
+
+}} // namespace detail::within
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_BOX_BAND_INDEX_HPP
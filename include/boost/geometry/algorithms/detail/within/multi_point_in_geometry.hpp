@@ -0,0 +1,423 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_MULTI_POINT_IN_GEOMETRY_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_MULTI_POINT_IN_GEOMETRY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/multi/algorithms/envelope.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within
+{
+
+
+// Distance within which coordinates are considered as equal by the
+// within strategies (see math::equals), such that filtering coordinates
+// with it gives the same results as not filtering
+template
+<
+    typename T,
+    bool IsFloatingPoint = boost::is_floating_point<T>::value
+>
+struct equality_tolerance
+{
+    static inline T apply(T const&)
+    {
+        return T();
+    }
+};
+
+template <typename T>
+struct equality_tolerance<T, true>
+{
+    static inline T apply(T const& value)
+    {
+        T const magnitude = (std::max)(T(1), T(std::abs(value)));
+        return 2 * std::numeric_limits<T>::epsilon() * magnitude;
+    }
+};
+
+
+/*!
+\brief Internal, classifies all points of a multi-point with respect to a
+    geometry, in a batch
+\details Codes are as point_in_geometry: 1 in the interior, 0 on the
+    boundary, -1 in the exterior. Points outside the envelope of the
+    geometry are classified on construction. For areal geometries, the
+    other points are sorted on y and each segment of each ring is only
+    applied to the points within its y-range: the winding strategy does
+    not count other segments. Results are the same as classifying the
+    points one by one.
+*/
+template <typename MultiPoint, typename Geometry>
+class multi_point_in_geometry
+{
+    typedef typename boost::range_value<MultiPoint>::type point_type;
+    typedef typename geometry::point_type<Geometry>::type geometry_point_type;
+
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<point_type>::type,
+            typename coordinate_type<geometry_point_type>::type
+        >::type calculation_type;
+
+    typedef typename strategy::within::services::default_strategy
+        <
+            point_tag,
+            typename tag<Geometry>::type,
+            point_tag,
+            typename tag_cast<typename tag<Geometry>::type, areal_tag>::type,
+            typename tag_cast
+                <
+                    typename cs_tag<point_type>::type, spherical_tag
+                >::type,
+            typename tag_cast
+                <
+                    typename cs_tag<geometry_point_type>::type, spherical_tag
+                >::type,
+            point_type,
+            Geometry
+        >::type strategy_type;
+
+    typedef typename strategy_type::state_type state_type;
+
+    // A point which is not yet classified, its state for the current ring
+    struct entry
+    {
+        calculation_type x;
+        calculation_type y;
+        std::size_t index;
+        state_type state;
+        bool done;
+    };
+
+    struct less_y
+    {
+        inline bool operator()(entry const& e, calculation_type const& y) const
+        {
+            return e.y < y;
+        }
+        inline bool operator()(calculation_type const& y, entry const& e) const
+        {
+            return y < e.y;
+        }
+        inline bool operator()(entry const& e1, entry const& e2) const
+        {
+            return e1.y < e2.y;
+        }
+    };
+
+    typedef std::vector<entry> entries_type;
+
+    static const int unknown = 2;
+
+public :
+
+    multi_point_in_geometry(MultiPoint const& multi_point,
+                Geometry const& geometry)
+        : m_geometry(geometry)
+        , m_points(boost::begin(multi_point))
+        , m_codes(boost::size(multi_point), -1)
+        , m_outside_envelope_count(0)
+    {
+        model::box<geometry_point_type> box;
+        geometry::envelope(geometry, box);
+
+        calculation_type const min_x = get<min_corner, 0>(box);
+        calculation_type const min_y = get<min_corner, 1>(box);
+        calculation_type const max_x = get<max_corner, 0>(box);
+        calculation_type const max_y = get<max_corner, 1>(box);
+
+        for (std::size_t i = 0; i < m_codes.size(); i++)
+        {
+            if (inside_range(get<0>(point(i)), min_x, max_x)
+                && inside_range(get<1>(point(i)), min_y, max_y))
+            {
+                m_codes[i] = unknown;
+            }
+            else
+            {
+                m_outside_envelope_count++;
+            }
+        }
+    }
+
+    //! Returns the number of points outside the envelope of the geometry,
+    //! in the exterior of the geometry
+    inline std::size_t outside_envelope_count() const
+    {
+        return m_outside_envelope_count;
+    }
+
+    //! Classifies the points within the envelope of the geometry
+    inline std::vector<int> const& classify()
+    {
+        typedef typename tag_cast
+            <
+                typename tag<Geometry>::type, areal_tag
+            >::type tag_type;
+
+        classify(tag_type());
+        return m_codes;
+    }
+
+private :
+
+    inline typename boost::range_reference<MultiPoint const>::type
+        point(std::size_t i) const
+    {
+        return *(m_points + i);
+    }
+
+    static inline bool inside_range(calculation_type const& value,
+                calculation_type const& min_value,
+                calculation_type const& max_value)
+    {
+        return value >= min_value - equality_tolerance<calculation_type>::apply(min_value)
+            && value <= max_value + equality_tolerance<calculation_type>::apply(max_value);
+    }
+
+    // Linear (or other) geometries: point by point
+    template <typename Tag>
+    inline void classify(Tag)
+    {
+        strategy_type strategy;
+        for (std::size_t i = 0; i < m_codes.size(); i++)
+        {
+            if (m_codes[i] == unknown)
+            {
+                m_codes[i] = detail::within::point_in_geometry(point(i),
+                                m_geometry, strategy);
+            }
+        }
+    }
+
+    inline void classify(areal_tag)
+    {
+        entries_type entries;
+        for (std::size_t i = 0; i < m_codes.size(); i++)
+        {
+            if (m_codes[i] == unknown)
+            {
+                entry e;
+                e.x = get<0>(point(i));
+                e.y = get<1>(point(i));
+                e.index = i;
+                e.done = false;
+                entries.push_back(e);
+                m_codes[i] = -1;
+            }
+        }
+        std::sort(entries.begin(), entries.end(), less_y());
+
+        classify_areal(m_geometry, entries, typename tag<Geometry>::type());
+    }
+
+    // Sets the codes of the entries with respect to the ring
+    template <typename Ring>
+    inline void classify_ring(Ring const& ring, entries_type& entries)
+    {
+        for (typename entries_type::iterator it = entries.begin();
+             it != entries.end(); ++it)
+        {
+            it->state = state_type();
+            it->done = false;
+        }
+
+        if (boost::size(ring) < core_detail::closure::minimum_ring_size
+                                    <
+                                        geometry::closure<Ring>::value
+                                    >::value)
+        {
+            for (typename entries_type::iterator it = entries.begin();
+                 it != entries.end(); ++it)
+            {
+                m_codes[it->index] = -1;
+            }
+            return;
+        }
+
+        typedef detail::normalized_view<Ring const> view_type;
+        typedef typename boost::range_iterator<view_type const>::type iterator;
+
+        strategy_type strategy;
+        view_type const view(ring);
+        iterator it = boost::begin(view);
+        for (iterator previous = it++; it != boost::end(view); ++previous, ++it)
+        {
+            calculation_type const y1 = get<1>(*previous);
+            calculation_type const y2 = get<1>(*it);
+            calculation_type const low = (std::min)(y1, y2);
+            calculation_type const high = (std::max)(y1, y2);
+
+            typename entries_type::iterator first
+                = std::lower_bound(entries.begin(), entries.end(),
+                    low - equality_tolerance<calculation_type>::apply(low),
+                    less_y());
+            typename entries_type::iterator last
+                = std::upper_bound(first, entries.end(),
+                    high + equality_tolerance<calculation_type>::apply(high),
+                    less_y());
+
+            for ( ; first != last; ++first)
+            {
+                if (! first->done
+                    && ! strategy.apply(point(first->index), *previous, *it,
+                                        first->state))
+                {
+                    first->done = true;
+                }
+            }
+        }
+
+        for (typename entries_type::iterator it = entries.begin();
+             it != entries.end(); ++it)
+        {
+            m_codes[it->index] = strategy.result(it->state);
+        }
+    }
+
+    template <typename Ring>
+    inline void classify_areal(Ring const& ring, entries_type& entries,
+                ring_tag)
+    {
+        classify_ring(ring, entries);
+    }
+
+    // Polygon: in exterior ring, and if so, not within interior ring(s)
+    template <typename Polygon>
+    inline void classify_areal(Polygon const& polygon, entries_type& entries,
+                polygon_tag)
+    {
+        classify_ring(exterior_ring(polygon), entries);
+        keep(entries, 1);
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+             it = boost::begin(rings);
+             it != boost::end(rings) && ! entries.empty();
+             ++it)
+        {
+            classify_ring(*it, entries);
+
+            // Inside a hole or on its boundary: exterior or boundary.
+            // Outside the hole: interior, unless in one of the next holes
+            for (typename entries_type::iterator eit = entries.begin();
+                 eit != entries.end(); ++eit)
+            {
+                m_codes[eit->index] = -m_codes[eit->index];
+            }
+            keep(entries, 1);
+        }
+    }
+
+    // Multi-polygon: in the first polygon having the point in its interior
+    // or on its boundary. Each polygon classifies the points within its
+    // envelope, which are not yet classified by another polygon.
+    template <typename MultiPolygon>
+    inline void classify_areal(MultiPolygon const& multi_polygon,
+                entries_type& entries, multi_polygon_tag)
+    {
+        entries_type candidates;
+        for (typename boost::range_iterator<MultiPolygon const>::type
+             it = boost::begin(multi_polygon);
+             it != boost::end(multi_polygon);
+             ++it)
+        {
+            model::box<geometry_point_type> box;
+            geometry::envelope(exterior_ring(*it), box);
+
+            calculation_type const min_x = get<min_corner, 0>(box);
+            calculation_type const min_y = get<min_corner, 1>(box);
+            calculation_type const max_x = get<max_corner, 0>(box);
+            calculation_type const max_y = get<max_corner, 1>(box);
+
+            typename entries_type::iterator first
+                = std::lower_bound(entries.begin(), entries.end(),
+                    min_y - equality_tolerance<calculation_type>::apply(min_y),
+                    less_y());
+            typename entries_type::iterator last
+                = std::upper_bound(first, entries.end(),
+                    max_y + equality_tolerance<calculation_type>::apply(max_y),
+                    less_y());
+
+            candidates.clear();
+            for ( ; first != last; ++first)
+            {
+                if (m_codes[first->index] < 0
+                    && inside_range(first->x, min_x, max_x))
+                {
+                    candidates.push_back(*first);
+                }
+            }
+
+            if (! candidates.empty())
+            {
+                classify_areal(*it, candidates, polygon_tag());
+            }
+        }
+    }
+
+    // Keeps the entries having the specified code
+    inline void keep(entries_type& entries, int code) const
+    {
+        typename entries_type::iterator out = entries.begin();
+        for (typename entries_type::iterator it = entries.begin();
+             it != entries.end(); ++it)
+        {
+            if (m_codes[it->index] == code)
+            {
+                *out++ = *it;
+            }
+        }
+        entries.erase(out, entries.end());
+    }
+
+    Geometry const& m_geometry;
+    typename boost::range_iterator<MultiPoint const>::type m_points;
+    std::vector<int> m_codes;
+    std::size_t m_outside_envelope_count;
+};
+
+
+}} // namespace detail::within
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_MULTI_POINT_IN_GEOMETRY_HPP
@@ -0,0 +1,239 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_RING_BAND_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_RING_BAND_INDEX_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/util/promote_floating_point.hpp>
+#include <boost/geometry/views/detail/normalized_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within
+{
+
+
+/*!
+\brief Index of the segments of a ring, divided into horizontal bands
+\details Only segments whose y-range contains the y-coordinate of a point
+    contribute to its winding number. The index divides the y-range of the
+    ring into bands, and registers each segment in the bands it spans, such
+    that a point is only compared with the segments of its band. This gives
+    the same result as point_in_range, using the same strategy, over all
+    segments.
+*/
+template <typename Ring, typename Strategy>
+class ring_band_index
+{
+    typedef typename geometry::point_type<Ring>::type point_type;
+    typedef typename promote_floating_point
+        <
+            typename geometry::coordinate_type<Ring>::type
+        >::type calculation_type;
+
+    // Maximum average number of registrations per segment, segments spanning
+    // many bands otherwise might let the index grow quadratically
+    static const std::size_t max_registrations = 8;
+
+public :
+    inline ring_band_index()
+        : m_valid(false)
+        , m_band_count(0)
+        , m_min_y(0)
+        , m_band_height(1)
+    {}
+
+    explicit inline ring_band_index(Ring const& ring)
+        : m_valid(false)
+        , m_band_count(0)
+        , m_min_y(0)
+        , m_band_height(1)
+    {
+        if (boost::size(ring) < core_detail::closure::minimum_ring_size
+                                    <
+                                        geometry::closure<Ring>::value
+                                    >::value)
+        {
+            return;
+        }
+
+        // Store the points normalized (closed, clockwise), such that
+        // the segments are the same as point_in_range would walk
+        detail::normalized_view<Ring const> view(ring);
+        m_points.assign(boost::begin(view), boost::end(view));
+        m_valid = true;
+
+        std::size_t const segment_count = m_points.size() - 1;
+
+        geometry::assign_inverse(m_envelope);
+        for (std::size_t i = 0; i < m_points.size(); i++)
+        {
+            geometry::expand(m_envelope, m_points[i]);
+        }
+
+        m_min_y = get<min_corner, 1>(m_envelope);
+        calculation_type const height
+            = calculation_type(get<max_corner, 1>(m_envelope)) - m_min_y;
+
+        // Start with as many bands as segments, and halve that until the
+        // registrations fit
+        m_band_count = segment_count;
+        std::size_t registrations = 0;
+        while (true)
+        {
+            m_band_height = m_band_count > 1 && height > 0
+                ? height / calculation_type(m_band_count)
+                : calculation_type(1);
+
+            registrations = 0;
+            for (std::size_t i = 0; i < segment_count; i++)
+            {
+                std::size_t first, last;
+                segment_bands(i, first, last);
+                registrations += last - first + 1;
+            }
+
+            if (m_band_count <= 1
+                || registrations <= max_registrations * segment_count)
+            {
+                break;
+            }
+            m_band_count /= 2;
+        }
+
+        // Fill the bands, stored consecutively (compressed rows)
+        m_offsets.assign(m_band_count + 1, 0);
+        for (std::size_t i = 0; i < segment_count; i++)
+        {
+            std::size_t first, last;
+            segment_bands(i, first, last);
+            for (std::size_t b = first; b <= last; b++)
+            {
+                m_offsets[b + 1]++;
+            }
+        }
+        for (std::size_t b = 0; b < m_band_count; b++)
+        {
+            m_offsets[b + 1] += m_offsets[b];
+        }
+
+        m_segments.resize(registrations);
+        std::vector<std::size_t> position(m_offsets.begin(), m_offsets.end() - 1);
+        for (std::size_t i = 0; i < segment_count; i++)
+        {
+            std::size_t first, last;
+            segment_bands(i, first, last);
+            for (std::size_t b = first; b <= last; b++)
+            {
+                m_segments[position[b]++] = i;
+            }
+        }
+    }
+
+    // Returns 1 (interior), 0 (boundary) or -1 (exterior),
+    // as point_in_geometry does for a ring
+    template <typename Point>
+    inline int apply(Point const& point, Strategy const& strategy) const
+    {
+        if (! m_valid
+            || get<0>(point) < get<min_corner, 0>(m_envelope)
+            || get<0>(point) > get<max_corner, 0>(m_envelope)
+            || get<1>(point) < get<min_corner, 1>(m_envelope)
+            || get<1>(point) > get<max_corner, 1>(m_envelope))
+        {
+            // Exterior, the boundary is located within the envelope
+            return -1;
+        }
+
+        std::size_t const band = band_of(get<1>(point));
+
+        typename Strategy::state_type state;
+        for (std::size_t i = m_offsets[band]; i < m_offsets[band + 1]; i++)
+        {
+            std::size_t const index = m_segments[i];
+            if (! strategy.apply(point, m_points[index],
+                        m_points[index + 1], state))
+            {
+                break;
+            }
+        }
+
+        return check_result_type(strategy.result(state));
+    }
+
+    //! Returns false if the ring has too few points, and no envelope
+    inline bool valid() const
+    {
+        return m_valid;
+    }
+
+    inline model::box<point_type> const& envelope() const
+    {
+        return m_envelope;
+    }
+
+private :
+    template <typename T>
+    inline std::size_t band_of(T const& y) const
+    {
+        calculation_type const b = (calculation_type(y) - m_min_y) / m_band_height;
+        if (b <= 0)
+        {
+            return 0;
+        }
+        std::size_t const result = static_cast<std::size_t>(b);
+        return result >= m_band_count ? m_band_count - 1 : result;
+    }
+
+    inline void segment_bands(std::size_t index,
+                std::size_t& first, std::size_t& last) const
+    {
+        std::size_t const b1 = band_of(get<1>(m_points[index]));
+        std::size_t const b2 = band_of(get<1>(m_points[index + 1]));
+        first = b1 < b2 ? b1 : b2;
+        last = b1 < b2 ? b2 : b1;
+    }
+
+    bool m_valid;
+    std::vector<point_type> m_points;
+    model::box<point_type> m_envelope;
+
+    std::size_t m_band_count;
+    calculation_type m_min_y;
+    calculation_type m_band_height;
+
+    std::vector<std::size_t> m_offsets;
+    std::vector<std::size_t> m_segments;
+};
+
+
+}} // namespace detail::within
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_WITHIN_RING_BAND_INDEX_HPP
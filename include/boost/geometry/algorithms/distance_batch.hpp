@@ -0,0 +1,611 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DISTANCE_BATCH_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DISTANCE_BATCH_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/spherical/distance_cross_track.hpp>
+#include <boost/geometry/strategies/spherical/distance_haversine.hpp>
+
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance_batch
+{
+
+
+// Sines and cosines of the coordinates of a range of points, of their
+// longitudes, latitudes and half of them, stored per component. With these,
+// distances and courses between points are calculated without further
+// trigonometric functions, apart from asin.
+template <typename T>
+struct spherical_points
+{
+    std::vector<T> sin_lon, cos_lon, sin_lat, cos_lat;
+    std::vector<T> sin_half_lon, cos_half_lon, sin_half_lat, cos_half_lat;
+
+    template <typename Point>
+    inline void add(Point const& point)
+    {
+        T const half = T(0.5);
+        T const lambda = get_as_radian<0>(point);
+        T const phi = get_as_radian<1>(point);
+        sin_lon.push_back(sin(lambda));
+        cos_lon.push_back(cos(lambda));
+        sin_lat.push_back(sin(phi));
+        cos_lat.push_back(cos(phi));
+        sin_half_lon.push_back(sin(half * lambda));
+        cos_half_lon.push_back(cos(half * lambda));
+        sin_half_lat.push_back(sin(half * phi));
+        cos_half_lat.push_back(cos(half * phi));
+    }
+
+    template <typename Range>
+    inline void add_range(Range const& range)
+    {
+        std::size_t const n = size() + boost::size(range);
+        sin_lon.reserve(n);
+        cos_lon.reserve(n);
+        sin_lat.reserve(n);
+        cos_lat.reserve(n);
+        sin_half_lon.reserve(n);
+        cos_half_lon.reserve(n);
+        sin_half_lat.reserve(n);
+        cos_half_lat.reserve(n);
+
+        for (typename boost::range_iterator<Range const>::type
+                it = boost::begin(range);
+             it != boost::end(range);
+             ++it)
+        {
+            add(*it);
+        }
+    }
+
+    inline std::size_t size() const
+    {
+        return sin_lon.size();
+    }
+
+    // Haversine of the angular distance from point j to point i of others:
+    // hav(dlat) + cos(lat1) * cos(lat2) * hav(dlon), where the sine of half
+    // of the differences is calculated by the angle difference identity
+    inline T hav(std::size_t j, spherical_points const& others,
+                std::size_t i) const
+    {
+        T const s_lat = others.sin_half_lat[i] * cos_half_lat[j]
+            - others.cos_half_lat[i] * sin_half_lat[j];
+        T const s_lon = others.sin_half_lon[i] * cos_half_lon[j]
+            - others.cos_half_lon[i] * sin_half_lon[j];
+        T const a = s_lat * s_lat
+            + cos_lat[j] * others.cos_lat[i] * (s_lon * s_lon);
+        return a < T(1) ? a : T(1);
+    }
+
+    // Sine and cosine of the course from point j to point i of others,
+    // as calculated by cross_track (using atan2)
+    inline void course(std::size_t j, spherical_points const& others,
+                std::size_t i, T& sin_course, T& cos_course) const
+    {
+        T const sin_dlon = others.sin_lon[i] * cos_lon[j]
+            - others.cos_lon[i] * sin_lon[j];
+        T const cos_dlon = others.cos_lon[i] * cos_lon[j]
+            + others.sin_lon[i] * sin_lon[j];
+        T const y = sin_dlon * others.cos_lat[i];
+        T const x = cos_lat[j] * others.sin_lat[i]
+            - sin_lat[j] * others.cos_lat[i] * cos_dlon;
+        T const h = math::sqrt(x * x + y * y);
+
+        // For coinciding points atan2 returns 0
+        T const inverse = h > T(0) ? T(1) / h : T(0);
+        sin_course = y * inverse;
+        cos_course = h > T(0) ? x * inverse : T(1);
+    }
+};
+
+
+// Distance kernels. They calculate the distances from one geometry to all
+// points, in loops without trigonometric calls other than asin, which
+// compilers can vectorize. They give the same results as the strategies,
+// apart from rounding.
+template <typename Strategy>
+struct point_kernel
+{};
+
+template <typename RadiusType, typename CalculationType>
+struct point_kernel
+    <
+        strategy::distance::haversine<RadiusType, CalculationType>
+    >
+{
+    typedef strategy::distance::haversine
+        <
+            RadiusType, CalculationType
+        > strategy_type;
+
+    // Distance from point j of the references to all points
+    template <typename T, typename Distances>
+    static inline void apply(strategy_type const& strategy,
+                spherical_points<T> const& references, std::size_t j,
+                spherical_points<T> const& points,
+                Distances& result, std::size_t offset)
+    {
+        T const radius = strategy.radius();
+        std::size_t const count = points.size();
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            T const a = references.hav(j, points, i);
+            result[offset + i] = radius * (T(2) * asin(math::sqrt(a)));
+        }
+    }
+};
+
+
+template <typename Strategy>
+struct track_kernel
+{};
+
+template
+<
+    typename CalculationType,
+    typename RadiusType,
+    typename HaversineCalculationType
+>
+struct track_kernel
+    <
+        strategy::distance::cross_track
+            <
+                CalculationType,
+                strategy::distance::haversine
+                    <
+                        RadiusType, HaversineCalculationType
+                    >
+            >
+    >
+{
+    typedef strategy::distance::cross_track
+        <
+            CalculationType,
+            strategy::distance::haversine
+                <
+                    RadiusType, HaversineCalculationType
+                >
+        > strategy_type;
+
+    // Distances and courses from one vertex to all points. They are
+    // shared by the two segments of the vertex
+    template <typename T>
+    struct vertex_row
+    {
+        std::vector<T> distance, sin_angle, sin_course, cos_course;
+    };
+
+    template <typename T>
+    static inline void calculate_row(T const& radius,
+                spherical_points<T> const& vertices, std::size_t j,
+                spherical_points<T> const& points,
+                vertex_row<T>& row)
+    {
+        std::size_t const count = points.size();
+
+        row.distance.resize(count);
+        row.sin_angle.resize(count);
+        row.sin_course.resize(count);
+        row.cos_course.resize(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            T const a = vertices.hav(j, points, i);
+            T const sqrt_a = math::sqrt(a);
+            row.distance[i] = radius * (T(2) * asin(sqrt_a));
+
+            // Sine of the angular distance, 2 * asin(sqrt(a))
+            row.sin_angle[i] = T(2) * sqrt_a * math::sqrt(T(1) - a);
+
+            vertices.course(j, points, i, row.sin_course[i], row.cos_course[i]);
+        }
+    }
+
+    // Distance from all points to the track through the vertices, which
+    // is the minimum of the distances to its segments
+    template <typename T, typename Distances>
+    static inline void apply(strategy_type const& strategy,
+                spherical_points<T> const& vertices,
+                spherical_points<T> const& points,
+                Distances& result, std::size_t offset)
+    {
+        std::size_t const count = points.size();
+        std::size_t const vertex_count = vertices.size();
+        if (vertex_count == 0)
+        {
+            // Empty tracks are rejected by the interface, unless
+            // BOOST_GEOMETRY_EMPTY_INPUT_NO_THROW is defined
+            for (std::size_t i = 0; i < count; i++)
+            {
+                result[offset + i] = T(0);
+            }
+            return;
+        }
+
+        T const radius = strategy.radius();
+
+        vertex_row<T> row_a, row_b;
+        calculate_row(radius, vertices, 0, points, row_a);
+
+        // Minimum distance found. A track of one point has the distance
+        // to that point, as cross_track has for a degenerate segment
+        std::vector<T> minimum(row_a.distance);
+
+        for (std::size_t j = 1; j < vertex_count; j++)
+        {
+            calculate_row(radius, vertices, j, points, row_b);
+
+            T const d3 = radius
+                * (T(2) * asin(math::sqrt(vertices.hav(j - 1, vertices, j))));
+            bool const degenerate = geometry::math::equals(d3, 0.0);
+            T sin_AB, cos_AB;
+            vertices.course(j - 1, vertices, j, sin_AB, cos_AB);
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                T const d1 = row_a.distance[i];
+                T const d2 = row_b.distance[i];
+
+                // Cosines and sine of the course differences, as in
+                // cross_track: d_crs1 = crs_AD - crs_AB and
+                // d_crs2 = crs_BD - crs_BA, where crs_BA = crs_AB - pi
+                T const cos_d_crs1 = row_a.cos_course[i] * cos_AB
+                    + row_a.sin_course[i] * sin_AB;
+                T const sin_d_crs1 = row_a.sin_course[i] * cos_AB
+                    - row_a.cos_course[i] * sin_AB;
+                T const cos_d_crs2 = -(row_b.cos_course[i] * cos_AB
+                    + row_b.sin_course[i] * sin_AB);
+
+                // Only the signs of the projections matter
+                T const projection1 = cos_d_crs1 * d1;
+                T const projection2 = cos_d_crs2 * d2;
+                T const xtd = radius
+                    * geometry::math::abs(asin(row_a.sin_angle[i] * sin_d_crs1));
+
+                T const d = degenerate ? d1
+                    : projection1 > 0.0 && projection2 > 0.0 ? xtd
+                    : (std::min)(d1, d2);
+
+                // As distance, which starts with the first segment and
+                // stops at a next segment having a distance equal to zero
+                minimum[i] = j == 1 || d < minimum[i] ? d
+                    : minimum[i];
+                minimum[i] = j > 1 && geometry::math::equals(d, T(0)) ? T(0)
+                    : minimum[i];
+            }
+
+            row_a.distance.swap(row_b.distance);
+            row_a.sin_angle.swap(row_b.sin_angle);
+            row_a.sin_course.swap(row_b.sin_course);
+            row_a.cos_course.swap(row_b.cos_course);
+        }
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            result[offset + i] = minimum[i];
+        }
+    }
+};
+
+
+template <typename T, typename Segment>
+inline void add_segment(Segment const& segment, spherical_points<T>& vertices)
+{
+    typename point_type<Segment>::type p;
+    geometry::detail::assign_point_from_index<0>(segment, p);
+    vertices.add(p);
+    geometry::detail::assign_point_from_index<1>(segment, p);
+    vertices.add(p);
+}
+
+
+}} // namespace detail::distance_batch
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+
+template
+<
+    typename Geometry,
+    typename Strategy,
+    typename Tag = typename tag<Geometry>::type
+>
+struct distance_batch : not_implemented<Tag>
+{};
+
+
+template <typename Point, typename Strategy>
+struct distance_batch<Point, Strategy, point_tag>
+{
+    template <typename T, typename Distances>
+    static inline void apply(Point const& point,
+                detail::distance_batch::spherical_points<T> const& points,
+                Distances& result, std::size_t offset,
+                Strategy const& strategy)
+    {
+        detail::distance_batch::spherical_points<T> reference;
+        reference.add(point);
+        detail::distance_batch::point_kernel<Strategy>::apply(strategy,
+                reference, 0, points, result, offset);
+    }
+};
+
+
+template <typename Segment, typename Strategy>
+struct distance_batch<Segment, Strategy, segment_tag>
+{
+    template <typename T, typename Distances>
+    static inline void apply(Segment const& segment,
+                detail::distance_batch::spherical_points<T> const& points,
+                Distances& result, std::size_t offset,
+                Strategy const& strategy)
+    {
+        detail::distance_batch::spherical_points<T> vertices;
+        detail::distance_batch::add_segment(segment, vertices);
+        detail::distance_batch::track_kernel<Strategy>::apply(strategy,
+                vertices, points, result, offset);
+    }
+};
+
+
+template <typename Linestring, typename Strategy>
+struct distance_batch<Linestring, Strategy, linestring_tag>
+{
+    template <typename T, typename Distances>
+    static inline void apply(Linestring const& linestring,
+                detail::distance_batch::spherical_points<T> const& points,
+                Distances& result, std::size_t offset,
+                Strategy const& strategy)
+    {
+        detail::distance_batch::spherical_points<T> vertices;
+        vertices.add_range(linestring);
+        detail::distance_batch::track_kernel<Strategy>::apply(strategy,
+                vertices, points, result, offset);
+    }
+};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance_batch
+{
+
+
+template <typename Points, typename Geometry, typename Strategy>
+struct calculation_type
+    : strategy::distance::services::return_type
+        <
+            Strategy,
+            typename boost::range_value<Points>::type,
+            typename point_type<Geometry>::type
+        >
+{};
+
+
+template <typename Points, typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct default_strategy
+    : strategy::distance::services::default_strategy
+        <
+            point_tag, point_tag,
+            typename boost::range_value<Points>::type,
+            typename point_type<Geometry>::type
+        >
+{};
+
+template <typename Points, typename Geometry>
+struct default_strategy<Points, Geometry, segment_tag>
+    : strategy::distance::services::default_strategy
+        <
+            point_tag, segment_tag,
+            typename boost::range_value<Points>::type,
+            typename point_type<Geometry>::type
+        >
+{};
+
+template <typename Points, typename Geometry>
+struct default_strategy<Points, Geometry, linestring_tag>
+    : default_strategy<Points, Geometry, segment_tag>
+{};
+
+
+}} // namespace detail::distance_batch
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the distance from each point of a range to a geometry \brief_strategy
+\ingroup distance
+\details The sines and cosines of the coordinates of the points are
+    calculated once. The distances are then calculated in loops over these
+    precomputed values, avoiding all trigonometric calls which distance
+    does per point, apart from asin.
+\tparam Points range of points
+\tparam Geometry \tparam_geometry (point, segment or linestring)
+\tparam Distances container of distances, having resize and operator[],
+    for example std::vector<double>
+\tparam Strategy haversine (for a point) or cross_track using haversine
+    (for a segment or linestring)
+\param points points of which the distance is calculated
+\param geometry \param_geometry
+\param result resized to the number of points, element i is the distance
+    from point i to the geometry
+\param strategy \param_strategy{distance}
+\note As distance, an empty_input_exception is thrown for an empty
+    linestring
+\note The results are the same as those of the strategies, apart from
+    rounding: they differ by a few times the radius times the machine
+    epsilon (for double coordinates on the earth, less than a micrometer)
+*/
+template <typename Points, typename Geometry, typename Distances, typename Strategy>
+inline void distance_batch(Points const& points, Geometry const& geometry,
+            Distances& result, Strategy const& strategy)
+{
+    concept::check<Geometry const>();
+
+    detail::throw_on_empty_input(geometry);
+
+    typedef typename detail::distance_batch::calculation_type
+        <
+            Points, Geometry, Strategy
+        >::type calculation_type;
+
+    detail::distance_batch::spherical_points<calculation_type> precomputed;
+    precomputed.add_range(points);
+
+    result.resize(precomputed.size());
+    dispatch::distance_batch<Geometry, Strategy>::apply(geometry,
+            precomputed, result, 0, strategy);
+}
+
+
+/*!
+\brief Calculates the distance from each point of a range to a geometry
+\ingroup distance
+\details Uses the default strategy of distance, haversine or cross_track
+    for spherical equatorial coordinates, see the overload with strategy
+\tparam Points range of points
+\tparam Geometry \tparam_geometry (point, segment or linestring)
+\tparam Distances container of distances, having resize and operator[],
+    for example std::vector<double>
+\param points points of which the distance is calculated
+\param geometry \param_geometry
+\param result resized to the number of points, element i is the distance
+    from point i to the geometry
+*/
+template <typename Points, typename Geometry, typename Distances>
+inline void distance_batch(Points const& points, Geometry const& geometry,
+            Distances& result)
+{
+    typedef typename detail::distance_batch::default_strategy
+        <
+            Points, Geometry
+        >::type strategy_type;
+
+    distance_batch(points, geometry, result, strategy_type());
+}
+
+
+/*!
+\brief Calculates the distances from each point of a range to each geometry
+    of another range \brief_strategy
+\ingroup distance
+\details As distance_batch, the points are precomputed once, for all
+    geometries.
+\tparam Points range of points
+\tparam Geometries range of points, segments or linestrings
+\tparam Distances container of distances, having resize and operator[],
+    for example std::vector<double>
+\tparam Strategy haversine (for points) or cross_track using haversine
+    (for segments or linestrings)
+\param points points of which the distance is calculated
+\param geometries geometries to which the distance is calculated
+\param result resized to the number of points times the number of
+    geometries, element j * N + i is the distance from point i to
+    geometry j, where N is the number of points
+\param strategy \param_strategy{distance}
+*/
+template <typename Points, typename Geometries, typename Distances, typename Strategy>
+inline void distance_matrix(Points const& points, Geometries const& geometries,
+            Distances& result, Strategy const& strategy)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+
+    concept::check<geometry_type const>();
+
+    typedef typename detail::distance_batch::calculation_type
+        <
+            Points, geometry_type, Strategy
+        >::type calculation_type;
+
+    detail::distance_batch::spherical_points<calculation_type> precomputed;
+    precomputed.add_range(points);
+    std::size_t const count = precomputed.size();
+
+    result.resize(count * boost::size(geometries));
+
+    std::size_t offset = 0;
+    for (typename boost::range_iterator<Geometries const>::type
+            it = boost::begin(geometries);
+         it != boost::end(geometries);
+         ++it, offset += count)
+    {
+        detail::throw_on_empty_input(*it);
+        dispatch::distance_batch<geometry_type, Strategy>::apply(*it,
+                precomputed, result, offset, strategy);
+    }
+}
+
+
+/*!
+\brief Calculates the distances from each point of a range to each geometry
+    of another range
+\ingroup distance
+\details Uses the default strategy of distance, haversine or cross_track
+    for spherical equatorial coordinates, see the overload with strategy
+\tparam Points range of points
+\tparam Geometries range of points, segments or linestrings
+\tparam Distances container of distances, having resize and operator[],
+    for example std::vector<double>
+\param points points of which the distance is calculated
+\param geometries geometries to which the distance is calculated
+\param result resized to the number of points times the number of
+    geometries, element j * N + i is the distance from point i to
+    geometry j, where N is the number of points
+*/
+template <typename Points, typename Geometries, typename Distances>
+inline void distance_matrix(Points const& points, Geometries const& geometries,
+            Distances& result)
+{
+    typedef typename detail::distance_batch::default_strategy
+        <
+            Points, typename boost::range_value<Geometries>::type
+        >::type strategy_type;
+
+    distance_matrix(points, geometries, result, strategy_type());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DISTANCE_BATCH_HPP
@@ -0,0 +1,302 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <set>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_order.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/policies/compare.hpp>
+
+#include <boost/geometry/strategies/side.hpp>
+
+#include <boost/geometry/views/detail/range_type.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/detail/as_range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace convex_hull
+{
+
+
+// One of the two monotone chains of a hull, sorted from the most left to
+// the most right point (as geometry::less). Using Factor -1 it is the lower
+// chain, turning left at each vertex; using Factor 1 it is the upper chain,
+// turning right, as in graham_andrew
+template <typename Point, typename SideStrategy, int Factor>
+class hull_chain
+{
+    typedef std::set<Point, geometry::less<Point> > set_type;
+    typedef typename set_type::iterator iterator;
+
+public :
+    typedef typename set_type::const_iterator const_iterator;
+
+    // Inserts a point and removes the points which are no longer on
+    // the chain. Returns false if the point is not on the chain
+    inline bool insert(Point const& p)
+    {
+        iterator next = m_points.lower_bound(p);
+        if (next != m_points.end() && ! m_less(p, *next))
+        {
+            // Point is already present
+            return false;
+        }
+
+        if (next != m_points.begin() && next != m_points.end())
+        {
+            iterator prev = next;
+            --prev;
+            if (! outside(*prev, *next, p))
+            {
+                return false;
+            }
+        }
+
+        iterator const it = m_points.insert(next, p);
+
+        // Remove points towards the right which are not convex anymore
+        next = it;
+        ++next;
+        while (next != m_points.end())
+        {
+            iterator next2 = next;
+            ++next2;
+            if (next2 == m_points.end() || outside(*it, *next2, *next))
+            {
+                break;
+            }
+            m_points.erase(next++);
+        }
+
+        // Remove points towards the left which are not convex anymore
+        while (it != m_points.begin())
+        {
+            iterator prev = it;
+            --prev;
+            if (prev == m_points.begin())
+            {
+                break;
+            }
+            iterator prev2 = prev;
+            --prev2;
+            if (outside(*prev2, *it, *prev))
+            {
+                break;
+            }
+            m_points.erase(prev);
+        }
+        return true;
+    }
+
+    inline std::size_t size() const { return m_points.size(); }
+    inline const_iterator begin() const { return m_points.begin(); }
+    inline const_iterator end() const { return m_points.end(); }
+    inline void clear() { m_points.clear(); }
+
+private :
+    // Returns true if p is strictly outside the segment p1-p2 with respect
+    // to this chain. Collinear points are not part of the hull
+    static inline bool outside(Point const& p1, Point const& p2, Point const& p)
+    {
+        return Factor * SideStrategy::apply(p1, p2, p) > 0;
+    }
+
+    set_type m_points;
+    geometry::less<Point> m_less;
+};
+
+
+}} // namespace detail::convex_hull
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Convex hull of a growing set of points
+\ingroup convex_hull
+\details The hull is maintained as the lower and the upper chain of
+    graham_andrew, each in an ordered set. Inserting a point costs
+    O(log n), amortized, where n is the number of points of the hull.
+    Points inside the hull are rejected after two lookups and points
+    which are not part of the hull anymore are removed. Unlike
+    convex_hull, the input is therefore not kept and the hull is not
+    calculated again for each update.
+\tparam Point \tparam_point
+\tparam SideStrategy side strategy, by default the side strategy of the
+    coordinate system, as used by graham_andrew
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.convex_hull convex_hull]
+}
+*/
+template
+<
+    typename Point,
+    typename SideStrategy = typename strategy::side::services::default_strategy
+        <
+            typename cs_tag<Point>::type
+        >::type
+>
+class incremental_convex_hull
+{
+    typedef detail::convex_hull::hull_chain<Point, SideStrategy, -1> lower_type;
+    typedef detail::convex_hull::hull_chain<Point, SideStrategy, 1> upper_type;
+
+public :
+    typedef Point point_type;
+
+    inline incremental_convex_hull()
+    {
+        concept::check<Point const>();
+    }
+
+    /*!
+    \brief Adds a point to the hull
+    \return true if the hull is changed, false if the point is inside
+        the hull or on its boundary
+    */
+    inline bool insert(Point const& point)
+    {
+        // Both calls are necessary: a new extreme is part of both chains
+        bool const in_lower = m_lower.insert(point);
+        bool const in_upper = m_upper.insert(point);
+        return in_lower || in_upper;
+    }
+
+    //! Adds all points of a range of points to the hull
+    template <typename Range>
+    inline void insert_range(Range const& range)
+    {
+        for (typename boost::range_iterator<Range const>::type it
+                = boost::begin(range); it != boost::end(range); ++it)
+        {
+            insert(*it);
+        }
+    }
+
+    //! Returns the number of (distinct) vertices of the hull
+    inline std::size_t size() const
+    {
+        std::size_t const n = m_lower.size() + m_upper.size();
+        // The most left and the most right point are in both chains
+        return n <= 2 ? n / 2 : n - 2;
+    }
+
+    inline bool empty() const { return m_lower.size() == 0; }
+
+    inline void clear()
+    {
+        m_lower.clear();
+        m_upper.clear();
+    }
+
+    /*!
+    \brief Assigns the current hull to a ring (or polygon, or linestring)
+    \details The points are written in the point order of the output
+        geometry and the ring is closed, unless the output geometry is
+        open, as by convex_hull
+    */
+    template <typename OutputGeometry>
+    inline void hull(OutputGeometry& output) const
+    {
+        concept::check<OutputGeometry>();
+
+        geometry::clear(output);
+        typedef typename geometry::detail::range_type
+            <
+                OutputGeometry
+            >::type range_type;
+        range_type& range
+            = geometry::detail::as_range<range_type>(output);
+
+        insert_points(std::back_inserter(range),
+            geometry::point_order<OutputGeometry>::value == clockwise,
+            geometry::closure<OutputGeometry>::value != open);
+    }
+
+    /*!
+    \brief Writes the points of the current hull to an output iterator
+    \details The first point is written again at the end, if the hull
+        has more than one point
+    */
+    template <typename OutputIterator>
+    inline OutputIterator hull_insert(OutputIterator out,
+                bool clockwise = true) const
+    {
+        return insert_points(out, clockwise, true);
+    }
+
+private :
+
+    template <typename OutputIterator>
+    inline OutputIterator insert_points(OutputIterator out,
+                bool clockwise, bool closed) const
+    {
+        if (clockwise)
+        {
+            out = std::copy(m_upper.begin(), m_upper.end(), out);
+            return copy_reversed(m_lower, out, closed);
+        }
+
+        out = std::copy(m_lower.begin(), m_lower.end(), out);
+        return copy_reversed(m_upper, out, closed);
+    }
+
+    // Writes the points of a chain from right to left, skipping the most
+    // right point which was written already. The most left point, which
+    // closes the ring, is only written if closed is true
+    template <typename Chain, typename OutputIterator>
+    static inline OutputIterator copy_reversed(Chain const& chain,
+                OutputIterator out, bool closed)
+    {
+        typedef typename Chain::const_iterator iterator;
+        iterator it = chain.end();
+        if (it == chain.begin())
+        {
+            return out;
+        }
+        --it;
+        while (it != chain.begin())
+        {
+            --it;
+            if (closed || it != chain.begin())
+            {
+                *out++ = *it;
+            }
+        }
+        return out;
+    }
+
+    lower_type m_lower;
+    upper_type m_upper;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
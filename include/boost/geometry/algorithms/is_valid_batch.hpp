@@ -0,0 +1,85 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_IS_VALID_BATCH_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_IS_VALID_BATCH_HPP
+
+#include <cstddef>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/algorithms/is_valid.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Checks for the geometries first until last of a random access range
+    if they are valid
+\ingroup is_valid
+\details The results of other geometries are not changed. Each geometry is
+    checked independently and is_valid does not keep any state, so disjoint
+    blocks of one range can be checked concurrently by the caller, if the
+    elements of Results can be assigned concurrently (as for
+    std::vector<char>, but not for std::vector<bool>).
+\tparam Geometries random access range of geometries
+\tparam Results random access container of booleans, at least as large as
+    the range of geometries
+\param geometries geometries to check
+\param first index of the first geometry to check
+\param last index past the last geometry to check
+\param results element i is set to true if geometry i is valid
+\return the number of invalid geometries within first and last
+*/
+template <typename Geometries, typename Results>
+inline std::size_t is_valid_batch(Geometries const& geometries,
+            std::size_t first, std::size_t last, Results& results)
+{
+    typename boost::range_iterator<Geometries const>::type
+        it = boost::begin(geometries) + first;
+
+    std::size_t invalid_count = 0;
+    for (std::size_t index = first; index < last; ++index, ++it)
+    {
+        bool const valid = geometry::is_valid(*it);
+        results[index] = valid;
+        if (! valid)
+        {
+            invalid_count++;
+        }
+    }
+    return invalid_count;
+}
+
+
+/*!
+\brief Checks for each geometry of a random access range if it is valid
+\ingroup is_valid
+\tparam Geometries random access range of geometries
+\tparam Results random access container of booleans, having resize,
+    for example std::vector<bool>
+\param geometries geometries to check
+\param results resized to the number of geometries, element i is set to
+    true if geometry i is valid
+\return the number of invalid geometries
+*/
+template <typename Geometries, typename Results>
+inline std::size_t is_valid_batch(Geometries const& geometries, Results& results)
+{
+    std::size_t const count = boost::size(geometries);
+    results.resize(count);
+    return is_valid_batch(geometries, 0, count, results);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_IS_VALID_BATCH_HPP
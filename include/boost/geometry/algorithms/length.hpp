@@ -89,27 +89,13 @@ struct range_length
     {
         boost::ignore_unused_variable_warning(strategy);
         typedef typename closeable_view<Range const, Closure>::type view_type;
-        typedef typename boost::range_iterator
-            <
-                view_type const
-            >::type iterator_type;
 
-        return_type sum = return_type();
         view_type view(range);
-        iterator_type it = boost::begin(view), end = boost::end(view);
-        if(it != end)
-        {
-            for(iterator_type previous = it++;
-                    it != end;
-                    ++previous, ++it)
-            {
-                // Add point-point distance using the return type belonging
-                // to strategy
-                sum += strategy.apply(*previous, *it);
-            }
-        }
-
-        return sum;
+        return strategy::distance::services::sum_range
+            <
+                Strategy
+            >::template apply<return_type>(strategy,
+                boost::begin(view), boost::end(view));
     }
 };
 
@@ -0,0 +1,429 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_OVERLAY_CONTEXT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_OVERLAY_CONTEXT_HPP
+
+
+#include <iterator>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/difference.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+
+#include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
+#include <boost/geometry/algorithms/detail/overlay/robust_policy_with_data.hpp>
+#include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/policies/robustness/robust_point_type.hpp>
+#include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
+
+#include <boost/geometry/strategies/intersection.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Context keeping the working memory of overlays between calls
+\ingroup overlay
+\details If an overlay context is passed to intersection, union_ or
+    difference, the turns and the monotonic sections of the overlay are
+    stored in the context. Their containers are cleared, but not released,
+    by the next call, such that many overlays of small geometries do not
+    allocate them again and again.
+\note An overlay context can be used by one overlay at a time. Use one
+    context per thread.
+\note Other working memory of the overlay (for example the traversed rings)
+    is allocated per call, as without context.
+\tparam Geometry type of the geometries, of which the point type is used
+\tparam RobustPolicy policy to handle robustness issues. Geometries of
+    which the rescale policy differs are processed without the context.
+*/
+template
+<
+    typename Geometry,
+    typename RobustPolicy = typename rescale_overlay_policy_type
+        <
+            Geometry, Geometry
+        >::type
+>
+class overlay_context
+{
+public :
+    typedef RobustPolicy robust_policy_type;
+    typedef typename geometry::point_type<Geometry>::type point_type;
+
+    typedef detail::overlay::traversal_turn_info
+        <
+            point_type,
+            typename geometry::segment_ratio_type
+                <
+                    point_type, RobustPolicy
+                >::type
+        > turn_info;
+
+    typedef geometry::sections
+        <
+            model::box
+                <
+                    typename geometry::robust_point_type
+                        <
+                            point_type, RobustPolicy
+                        >::type
+                >,
+            2
+        > sections_type;
+
+    typedef detail::overlay::robust_policy_with_data
+        <
+            RobustPolicy, overlay_context
+        > context_policy_type;
+
+    inline std::vector<turn_info>& turns() { return m_turns; }
+
+    inline sections_type& sections(int source_index)
+    {
+        return m_sections[source_index == 0 ? 0 : 1];
+    }
+
+    inline context_policy_type policy(RobustPolicy const& robust_policy)
+    {
+        return context_policy_type(robust_policy, *this);
+    }
+
+    //! Releases the memory kept by the context
+    inline void clear()
+    {
+        std::vector<turn_info>().swap(m_turns);
+        sections_type().swap(m_sections[0]);
+        sections_type().swap(m_sections[1]);
+    }
+
+private :
+    std::vector<turn_info> m_turns;
+    sections_type m_sections[2];
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace overlay
+{
+
+
+template <typename Geometry, typename RobustPolicy>
+struct get_turn_container
+    <
+        robust_policy_with_data
+            <
+                RobustPolicy, overlay_context<Geometry, RobustPolicy>
+            >,
+        typename overlay_context<Geometry, RobustPolicy>::turn_info
+    >
+{
+    typedef typename overlay_context
+        <
+            Geometry, RobustPolicy
+        >::turn_info turn_info;
+
+    // Turns are only added during get_turns, so a vector, which keeps its
+    // capacity when it is cleared, can be used instead of a deque
+    typedef std::vector<turn_info> type;
+
+    template <typename Policy>
+    static inline type& apply(Policy const& robust_policy, type& )
+    {
+        type& turns = robust_policy.data().turns();
+        turns.clear();
+        return turns;
+    }
+};
+
+
+template <typename Sections, typename ContextSections>
+struct select_context_sections
+{
+    // Sections of another (robust) point type: use the local ones
+    template <bool Reverse, typename Geometry, typename RobustPolicy>
+    static inline Sections const& apply(Geometry const& geometry,
+            RobustPolicy const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        geometry::sectionalize<Reverse>(geometry, robust_policy, true,
+                sections, source_index);
+        return sections;
+    }
+};
+
+template <typename Sections>
+struct select_context_sections<Sections, Sections>
+{
+    template <bool Reverse, typename Geometry, typename RobustPolicy>
+    static inline Sections const& apply(Geometry const& geometry,
+            RobustPolicy const& robust_policy,
+            Sections& , int source_index)
+    {
+        // sectionalize clears the sections, which keep their capacity
+        Sections& sections = robust_policy.data().sections(source_index);
+        geometry::sectionalize<Reverse>(geometry, robust_policy, true,
+                sections, source_index);
+        return sections;
+    }
+};
+
+template <typename Geometry, typename RobustPolicy>
+struct sections_from_data<overlay_context<Geometry, RobustPolicy> >
+{
+    template <bool Reverse, typename Geometry1, typename Policy, typename Sections>
+    static inline Sections const& apply(Geometry1 const& geometry,
+            Policy const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        return select_context_sections
+            <
+                Sections,
+                typename overlay_context<Geometry, RobustPolicy>::sections_type
+            >::template apply<Reverse>(geometry, robust_policy,
+                sections, source_index);
+    }
+};
+
+
+template
+<
+    typename Geometry1, typename Geometry2, typename Context,
+    bool UseContext = boost::is_same
+        <
+            typename geometry::rescale_overlay_policy_type
+                <
+                    Geometry1, Geometry2
+                >::type,
+            typename Context::robust_policy_type
+        >::value
+>
+struct context_set_operations
+{
+    // The rescaling of this combination differs from the one of the
+    // context, so the context cannot be used
+
+    template <typename Collection>
+    static inline bool intersection(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection, Context& )
+    {
+        return geometry::intersection(geometry1, geometry2, output_collection);
+    }
+
+    template <typename Collection>
+    static inline void union_(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection, Context& )
+    {
+        geometry::union_(geometry1, geometry2, output_collection);
+    }
+
+    template <typename Collection>
+    static inline void difference(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection, Context& )
+    {
+        geometry::difference(geometry1, geometry2, output_collection);
+    }
+};
+
+
+template <typename Geometry1, typename Geometry2, typename Context>
+struct context_set_operations<Geometry1, Geometry2, Context, true>
+{
+    typedef typename Context::robust_policy_type robust_policy_type;
+    typedef typename Context::context_policy_type policy_type;
+
+    template <typename Collection>
+    static inline bool intersection(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection, Context& context)
+    {
+        robust_policy_type robust_policy
+            = geometry::get_rescale_policy<robust_policy_type>(geometry1,
+                    geometry2);
+
+        typedef strategy_intersection
+            <
+                typename cs_tag<Geometry1>::type,
+                Geometry1,
+                Geometry2,
+                typename geometry::point_type<Geometry1>::type,
+                policy_type
+            > strategy;
+
+        return geometry::dispatch::intersection
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, context.policy(robust_policy),
+                    output_collection, strategy());
+    }
+
+    template <typename Collection>
+    static inline void union_(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection, Context& context)
+    {
+        typedef typename boost::range_value<Collection>::type geometry_out;
+        concept::check<geometry_out>();
+
+        robust_policy_type robust_policy
+            = geometry::get_rescale_policy<robust_policy_type>(geometry1,
+                    geometry2);
+
+        typedef strategy_intersection
+            <
+                typename cs_tag<geometry_out>::type,
+                Geometry1,
+                Geometry2,
+                typename geometry::point_type<geometry_out>::type,
+                policy_type
+            > strategy;
+
+        detail::union_::insert<geometry_out>(geometry1, geometry2,
+                context.policy(robust_policy),
+                std::back_inserter(output_collection), strategy());
+    }
+
+    template <typename Collection>
+    static inline void difference(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection, Context& context)
+    {
+        typedef typename boost::range_value<Collection>::type geometry_out;
+        concept::check<geometry_out>();
+
+        robust_policy_type robust_policy
+            = geometry::get_rescale_policy<robust_policy_type>(geometry1,
+                    geometry2);
+
+        detail::difference::difference_insert<geometry_out>(
+                geometry1, geometry2, context.policy(robust_policy),
+                std::back_inserter(output_collection));
+    }
+};
+
+
+}} // namespace detail::overlay
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the intersection of two geometries, reusing the working
+    memory kept by an overlay context
+\ingroup overlay
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param geometry_out The output collection
+\param context the overlay context
+*/
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename GeometryOut,
+    typename Geometry, typename RobustPolicy
+>
+inline bool intersection(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            GeometryOut& geometry_out,
+            overlay_context<Geometry, RobustPolicy>& context)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    return detail::overlay::context_set_operations
+        <
+            Geometry1, Geometry2,
+            overlay_context<Geometry, RobustPolicy>
+        >::intersection(geometry1, geometry2, geometry_out, context);
+}
+
+
+/*!
+\brief Combines two geometries, reusing the working memory kept by an
+    overlay context
+\ingroup overlay
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param output_collection the output collection
+\param context the overlay context
+*/
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Collection,
+    typename Geometry, typename RobustPolicy
+>
+inline void union_(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection,
+            overlay_context<Geometry, RobustPolicy>& context)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    detail::overlay::context_set_operations
+        <
+            Geometry1, Geometry2,
+            overlay_context<Geometry, RobustPolicy>
+        >::union_(geometry1, geometry2, output_collection, context);
+}
+
+
+/*!
+\brief Calculates the difference of two geometries, reusing the working
+    memory kept by an overlay context
+\ingroup overlay
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param output_collection the output collection
+\param context the overlay context
+*/
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Collection,
+    typename Geometry, typename RobustPolicy
+>
+inline void difference(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Collection& output_collection,
+            overlay_context<Geometry, RobustPolicy>& context)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    detail::overlay::context_set_operations
+        <
+            Geometry1, Geometry2,
+            overlay_context<Geometry, RobustPolicy>
+        >::difference(geometry1, geometry2, output_collection, context);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_OVERLAY_CONTEXT_HPP
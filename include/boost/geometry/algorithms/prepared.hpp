@@ -0,0 +1,863 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+
+
+#include <deque>
+#include <iterator>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/difference.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/areal_areal.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/linear_linear.hpp>
+#include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/robust_policy_with_data.hpp>
+#include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+#include <boost/geometry/policies/disjoint_interrupt_policy.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/policies/robustness/robust_point_type.hpp>
+#include <boost/geometry/policies/robustness/segment_ratio_type.hpp>
+
+#include <boost/geometry/strategies/intersection.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Geometry prepared for repeated overlays and predicates
+\ingroup prepared
+\details A prepared geometry caches the envelope, the robust (rescale)
+    policy and the monotonic sections of one geometry. If it is passed to
+    intersection, union_, difference, intersects or disjoint instead of the
+    geometry itself, these are not calculated again for each call. Only the
+    other geometry is sectionalized.
+\note The cached data are valid as long as the geometry is not modified.
+    The prepared geometry refers to the geometry, which should therefore
+    outlive it.
+\note The robust policy is based on the envelope of the prepared geometry,
+    optionally enlarged with a specified domain. Geometries which are not
+    inside that domain are processed without the prepared data.
+\tparam Geometry \tparam_geometry
+\tparam RobustPolicy policy to handle robustness issues
+*/
+template
+<
+    typename Geometry,
+    typename RobustPolicy = typename rescale_overlay_policy_type
+        <
+            Geometry, Geometry
+        >::type
+>
+class prepared_geometry
+{
+public :
+    typedef Geometry geometry_type;
+    typedef RobustPolicy robust_policy_type;
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef model::box<point_type> box_type;
+
+    typedef geometry::sections
+        <
+            model::box
+                <
+                    typename geometry::robust_point_type
+                        <
+                            point_type, RobustPolicy
+                        >::type
+                >,
+            2
+        > sections_type;
+
+    typedef detail::overlay::robust_policy_with_data
+        <
+            RobustPolicy, prepared_geometry const
+        > prepared_policy_type;
+
+    explicit inline prepared_geometry(Geometry const& geometry)
+        : m_geometry(geometry)
+        , m_envelope(geometry::return_envelope<box_type>(geometry))
+        , m_domain(m_envelope)
+        , m_robust_policy(geometry::get_rescale_policy<RobustPolicy>(m_domain))
+    {
+        init();
+    }
+
+    /*!
+    \brief Prepares a geometry for geometries within a specified domain
+    \details The robust policy is based on the specified domain, enlarged
+        with the envelope of the geometry, such that geometries exceeding
+        the envelope can be processed with the prepared data as well.
+    */
+    inline prepared_geometry(Geometry const& geometry, box_type const& domain)
+        : m_geometry(geometry)
+        , m_envelope(geometry::return_envelope<box_type>(geometry))
+        , m_domain(enlarged(m_envelope, domain))
+        , m_robust_policy(geometry::get_rescale_policy<RobustPolicy>(m_domain))
+    {
+        init();
+    }
+
+    inline Geometry const& geometry() const { return m_geometry; }
+    inline box_type const& envelope() const { return m_envelope; }
+    inline RobustPolicy const& robust_policy() const { return m_robust_policy; }
+
+    template <bool Reverse>
+    inline sections_type const& sections() const
+    {
+        return Reverse ? m_reversed_sections : m_sections;
+    }
+
+    //! Returns true if a geometry with the specified envelope can be
+    //! processed with the prepared data
+    inline bool covers(box_type const& box) const
+    {
+        return ! RobustPolicy::enabled
+            || geometry::covered_by(box, m_domain);
+    }
+
+    inline prepared_policy_type policy() const
+    {
+        return prepared_policy_type(m_robust_policy, *this);
+    }
+
+private :
+    static inline box_type enlarged(box_type box, box_type const& domain)
+    {
+        geometry::expand(box, domain);
+        return box;
+    }
+
+    inline void init()
+    {
+        geometry::sectionalize<false>(m_geometry, m_robust_policy, true,
+                    m_sections);
+        geometry::sectionalize<true>(m_geometry, m_robust_policy, true,
+                    m_reversed_sections);
+    }
+
+    Geometry const& m_geometry;
+    box_type m_envelope;
+    box_type m_domain;
+    RobustPolicy m_robust_policy;
+    sections_type m_sections;
+    sections_type m_reversed_sections;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+
+template <typename Sections, typename PreparedSections>
+struct select_sections
+{
+    // Sections of another (robust) point type: just sectionalize
+    template <bool Reverse, typename Geometry, typename RobustPolicy>
+    static inline Sections const& apply(Geometry const& geometry,
+            RobustPolicy const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        geometry::sectionalize<Reverse>(geometry, robust_policy, true,
+                sections, source_index);
+        return sections;
+    }
+};
+
+template <typename Sections>
+struct select_sections<Sections, Sections>
+{
+    template <bool Reverse, typename Geometry, typename RobustPolicy>
+    static inline Sections const& apply(Geometry const& geometry,
+            RobustPolicy const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        void const* prepared = &robust_policy.data().geometry();
+        if (prepared == &geometry)
+        {
+            // The source index is not used by get_turns, so the sections
+            // are valid for either of the two sources.
+            return robust_policy.data().template sections<Reverse>();
+        }
+
+        geometry::sectionalize<Reverse>(geometry, robust_policy, true,
+                sections, source_index);
+        return sections;
+    }
+};
+
+
+}} // namespace detail::prepared
+
+
+namespace detail { namespace overlay
+{
+
+template <typename Geometry, typename RobustPolicy>
+struct sections_from_data<prepared_geometry<Geometry, RobustPolicy> >
+{
+    template <bool Reverse, typename Geometry1, typename Policy, typename Sections>
+    static inline Sections const& apply(Geometry1 const& geometry,
+            Policy const& robust_policy,
+            Sections& sections, int source_index)
+    {
+        return detail::prepared::select_sections
+            <
+                Sections,
+                typename prepared_geometry
+                    <
+                        Geometry, RobustPolicy
+                    >::sections_type
+            >::template apply<Reverse>(geometry, robust_policy,
+                sections, source_index);
+    }
+};
+
+}} // namespace detail::overlay
+
+
+namespace detail { namespace prepared
+{
+
+
+template <typename Prepared, typename Geometry1, typename Geometry2>
+struct use_prepared_overlay
+    : boost::is_same
+        <
+            typename geometry::rescale_overlay_policy_type
+                <
+                    Geometry1, Geometry2
+                >::type,
+            typename Prepared::robust_policy_type
+        >
+{};
+
+
+template
+<
+    typename Geometry1, typename Geometry2, typename Prepared,
+    bool UsePrepared = use_prepared_overlay
+        <
+            Prepared, Geometry1, Geometry2
+        >::value
+>
+struct set_operations
+{
+    // The rescaling of this combination differs from the one of the
+    // prepared geometry, so the prepared data cannot be used
+
+    template <typename Other, typename Collection>
+    static inline bool intersection(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& , Other const& ,
+            Collection& output_collection)
+    {
+        return geometry::intersection(geometry1, geometry2, output_collection);
+    }
+
+    template <typename Other, typename Collection>
+    static inline void union_(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& , Other const& ,
+            Collection& output_collection)
+    {
+        geometry::union_(geometry1, geometry2, output_collection);
+    }
+
+    template <typename Other, typename Collection>
+    static inline void difference(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& , Other const& ,
+            Collection& output_collection)
+    {
+        geometry::difference(geometry1, geometry2, output_collection);
+    }
+};
+
+
+template <typename Geometry1, typename Geometry2, typename Prepared>
+struct set_operations<Geometry1, Geometry2, Prepared, true>
+{
+    typedef typename Prepared::prepared_policy_type policy_type;
+
+    template <typename Other, typename Collection>
+    static inline bool intersection(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& prepared, Other const& other,
+            Collection& output_collection)
+    {
+        typename Prepared::box_type const box
+            = geometry::return_envelope<typename Prepared::box_type>(other);
+
+        if (! prepared.covers(box))
+        {
+            return geometry::intersection(geometry1, geometry2,
+                        output_collection);
+        }
+
+        if (detail::disjoint::disjoint_box_box(box, prepared.envelope()))
+        {
+            // Nothing to add
+            return true;
+        }
+
+        typedef strategy_intersection
+            <
+                typename cs_tag<Geometry1>::type,
+                Geometry1,
+                Geometry2,
+                typename geometry::point_type<Geometry1>::type,
+                policy_type
+            > strategy;
+
+        return dispatch::intersection
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, prepared.policy(),
+                    output_collection, strategy());
+    }
+
+    template <typename Other, typename Collection>
+    static inline void union_(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& prepared, Other const& other,
+            Collection& output_collection)
+    {
+        if (! prepared.covers(geometry::return_envelope
+                <typename Prepared::box_type>(other)))
+        {
+            geometry::union_(geometry1, geometry2, output_collection);
+            return;
+        }
+
+        typedef typename boost::range_value<Collection>::type geometry_out;
+        concept::check<geometry_out>();
+
+        typedef strategy_intersection
+            <
+                typename cs_tag<geometry_out>::type,
+                Geometry1,
+                Geometry2,
+                typename geometry::point_type<geometry_out>::type,
+                policy_type
+            > strategy;
+
+        detail::union_::insert<geometry_out>(geometry1, geometry2,
+                prepared.policy(), std::back_inserter(output_collection),
+                strategy());
+    }
+
+    template <typename Other, typename Collection>
+    static inline void difference(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& prepared, Other const& other,
+            Collection& output_collection)
+    {
+        if (! prepared.covers(geometry::return_envelope
+                <typename Prepared::box_type>(other)))
+        {
+            geometry::difference(geometry1, geometry2, output_collection);
+            return;
+        }
+
+        typedef typename boost::range_value<Collection>::type geometry_out;
+        concept::check<geometry_out>();
+
+        detail::difference::difference_insert<geometry_out>(
+                geometry1, geometry2, prepared.policy(),
+                std::back_inserter(output_collection));
+    }
+};
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct prepared_tag
+    : tag_cast<Tag, polygonal_tag, linear_tag>
+{};
+
+template <typename Geometry>
+struct prepared_tag<Geometry, segment_tag>
+{
+    typedef segment_tag type;
+};
+
+
+template
+<
+    typename Geometry1, typename Geometry2,
+    typename Tag1 = typename prepared_tag<Geometry1>::type,
+    typename Tag2 = typename prepared_tag<Geometry2>::type
+>
+struct disjoint
+{
+    // Other combinations do not use get_turns: nothing is reused
+    template <typename Prepared>
+    static inline bool apply(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& )
+    {
+        return geometry::disjoint(geometry1, geometry2);
+    }
+};
+
+
+template <typename Geometry1, typename Geometry2>
+struct disjoint_by_turns
+{
+    // Returns true if there are no turns, using the prepared sections.
+    // This is the same as disjoint_linear, but with the robust policy
+    // of the prepared geometry
+    template <typename Prepared>
+    static inline bool apply(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& prepared)
+    {
+        typedef typename geometry::point_type<Geometry1>::type point_type;
+        typedef typename Prepared::prepared_policy_type policy_type;
+        typedef overlay::turn_info
+            <
+                point_type,
+                typename segment_ratio_type<point_type, policy_type>::type
+            > turn_info;
+        std::deque<turn_info> turns;
+
+        static const bool reverse1 = overlay::do_reverse<geometry::point_order<Geometry1>::value>::value;
+        static const bool reverse2 = overlay::do_reverse<geometry::point_order<Geometry2>::value>::value;
+
+        detail::disjoint::disjoint_interrupt_policy interrupt_policy;
+        geometry::get_turns
+            <
+                reverse1, reverse2,
+                detail::disjoint::assign_disjoint_policy
+            >(geometry1, geometry2, prepared.policy(), turns, interrupt_policy);
+
+        return ! interrupt_policy.has_intersections;
+    }
+};
+
+
+template <typename Linear1, typename Linear2>
+struct disjoint<Linear1, Linear2, linear_tag, linear_tag>
+    : disjoint_by_turns<Linear1, Linear2>
+{};
+
+
+template <typename Linear, typename Areal>
+struct disjoint<Linear, Areal, linear_tag, polygonal_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Linear const& linear, Areal const& areal,
+            Prepared const& prepared)
+    {
+        if (! disjoint_by_turns<Linear, Areal>::apply(linear, areal, prepared))
+        {
+            return false;
+        }
+
+        typename geometry::point_type<Linear>::type p;
+        geometry::point_on_border(p, linear);
+        return ! geometry::covered_by(p, areal);
+    }
+};
+
+
+template <typename Areal, typename Linear>
+struct disjoint<Areal, Linear, polygonal_tag, linear_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Areal const& areal, Linear const& linear,
+            Prepared const& prepared)
+    {
+        if (! disjoint_by_turns<Areal, Linear>::apply(areal, linear, prepared))
+        {
+            return false;
+        }
+
+        typename geometry::point_type<Linear>::type p;
+        geometry::point_on_border(p, linear);
+        return ! geometry::covered_by(p, areal);
+    }
+};
+
+
+template <typename Areal1, typename Areal2>
+struct disjoint<Areal1, Areal2, polygonal_tag, polygonal_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Areal1 const& areal1, Areal2 const& areal2,
+            Prepared const& prepared)
+    {
+        if (! disjoint_by_turns<Areal1, Areal2>::apply(areal1, areal2, prepared))
+        {
+            return false;
+        }
+
+        // No turns, they might be located inside each other
+        return ! detail::disjoint::rings_containing(areal1, areal2)
+            && ! detail::disjoint::rings_containing(areal2, areal1);
+    }
+};
+
+
+template <typename Geometry1, typename Geometry2, typename Prepared, typename Other>
+inline bool disjoint_prepared(Geometry1 const& geometry1,
+            Geometry2 const& geometry2,
+            Prepared const& prepared, Other const& other)
+{
+    typename Prepared::box_type const box
+        = geometry::return_envelope<typename Prepared::box_type>(other);
+
+    if (detail::disjoint::disjoint_box_box(box, prepared.envelope()))
+    {
+        return true;
+    }
+
+    if (! prepared.covers(box))
+    {
+        return geometry::disjoint(geometry1, geometry2);
+    }
+
+    return disjoint<Geometry1, Geometry2>::apply(geometry1, geometry2, prepared);
+}
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the intersection of a prepared geometry and a geometry
+\ingroup prepared
+\param prepared1 the prepared geometry
+\param geometry2 \param_geometry
+\param geometry_out The output collection
+*/
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2,
+    typename GeometryOut
+>
+inline bool intersection(
+            prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            Geometry2 const& geometry2,
+            GeometryOut& geometry_out)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    return detail::prepared::set_operations
+        <
+            Geometry1, Geometry2,
+            prepared_geometry<Geometry1, RobustPolicy1>
+        >::intersection(prepared1.geometry(), geometry2,
+                prepared1, geometry2, geometry_out);
+}
+
+/*!
+\brief Calculates the intersection of a geometry and a prepared geometry
+\ingroup prepared
+\param geometry1 \param_geometry
+\param prepared2 the prepared geometry
+\param geometry_out The output collection
+*/
+template
+<
+    typename Geometry1,
+    typename Geometry2, typename RobustPolicy2,
+    typename GeometryOut
+>
+inline bool intersection(Geometry1 const& geometry1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2,
+            GeometryOut& geometry_out)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    return detail::prepared::set_operations
+        <
+            Geometry1, Geometry2,
+            prepared_geometry<Geometry2, RobustPolicy2>
+        >::intersection(geometry1, prepared2.geometry(),
+                prepared2, geometry1, geometry_out);
+}
+
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2, typename RobustPolicy2,
+    typename GeometryOut
+>
+inline bool intersection(
+            prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2,
+            GeometryOut& geometry_out)
+{
+    return geometry::intersection(prepared1, prepared2.geometry(),
+                geometry_out);
+}
+
+
+/*!
+\brief Combines a prepared geometry with a geometry
+\ingroup prepared
+\param prepared1 the prepared geometry
+\param geometry2 \param_geometry
+\param output_collection the output collection
+*/
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2,
+    typename Collection
+>
+inline void union_(prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            Geometry2 const& geometry2,
+            Collection& output_collection)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    detail::prepared::set_operations
+        <
+            Geometry1, Geometry2,
+            prepared_geometry<Geometry1, RobustPolicy1>
+        >::union_(prepared1.geometry(), geometry2,
+                prepared1, geometry2, output_collection);
+}
+
+/*!
+\brief Combines a geometry with a prepared geometry
+\ingroup prepared
+\param geometry1 \param_geometry
+\param prepared2 the prepared geometry
+\param output_collection the output collection
+*/
+template
+<
+    typename Geometry1,
+    typename Geometry2, typename RobustPolicy2,
+    typename Collection
+>
+inline void union_(Geometry1 const& geometry1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2,
+            Collection& output_collection)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    detail::prepared::set_operations
+        <
+            Geometry1, Geometry2,
+            prepared_geometry<Geometry2, RobustPolicy2>
+        >::union_(geometry1, prepared2.geometry(),
+                prepared2, geometry1, output_collection);
+}
+
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2, typename RobustPolicy2,
+    typename Collection
+>
+inline void union_(prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2,
+            Collection& output_collection)
+{
+    geometry::union_(prepared1, prepared2.geometry(), output_collection);
+}
+
+
+/*!
+\brief Calculates the difference of a prepared geometry and a geometry
+\ingroup prepared
+\param prepared1 the prepared geometry
+\param geometry2 \param_geometry
+\param output_collection the output collection
+*/
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2,
+    typename Collection
+>
+inline void difference(
+            prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            Geometry2 const& geometry2,
+            Collection& output_collection)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    detail::prepared::set_operations
+        <
+            Geometry1, Geometry2,
+            prepared_geometry<Geometry1, RobustPolicy1>
+        >::difference(prepared1.geometry(), geometry2,
+                prepared1, geometry2, output_collection);
+}
+
+/*!
+\brief Calculates the difference of a geometry and a prepared geometry
+\ingroup prepared
+\param geometry1 \param_geometry
+\param prepared2 the prepared geometry
+\param output_collection the output collection
+*/
+template
+<
+    typename Geometry1,
+    typename Geometry2, typename RobustPolicy2,
+    typename Collection
+>
+inline void difference(Geometry1 const& geometry1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2,
+            Collection& output_collection)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    detail::prepared::set_operations
+        <
+            Geometry1, Geometry2,
+            prepared_geometry<Geometry2, RobustPolicy2>
+        >::difference(geometry1, prepared2.geometry(),
+                prepared2, geometry1, output_collection);
+}
+
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2, typename RobustPolicy2,
+    typename Collection
+>
+inline void difference(
+            prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2,
+            Collection& output_collection)
+{
+    geometry::difference(prepared1, prepared2.geometry(), output_collection);
+}
+
+
+/*!
+\brief Checks if a prepared geometry and a geometry are disjoint
+\ingroup prepared
+\param prepared1 the prepared geometry
+\param geometry2 \param_geometry
+*/
+template <typename Geometry1, typename RobustPolicy1, typename Geometry2>
+inline bool disjoint(prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            Geometry2 const& geometry2)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    return detail::prepared::disjoint_prepared(prepared1.geometry(), geometry2,
+                prepared1, geometry2);
+}
+
+/*!
+\brief Checks if a geometry and a prepared geometry are disjoint
+\ingroup prepared
+\param geometry1 \param_geometry
+\param prepared2 the prepared geometry
+*/
+template <typename Geometry1, typename Geometry2, typename RobustPolicy2>
+inline bool disjoint(Geometry1 const& geometry1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2)
+{
+    concept::check<Geometry1 const>();
+    concept::check<Geometry2 const>();
+
+    return detail::prepared::disjoint_prepared(geometry1, prepared2.geometry(),
+                prepared2, geometry1);
+}
+
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2, typename RobustPolicy2
+>
+inline bool disjoint(prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2)
+{
+    return geometry::disjoint(prepared1, prepared2.geometry());
+}
+
+
+/*!
+\brief Checks if a prepared geometry and a geometry intersect
+\ingroup prepared
+\param prepared1 the prepared geometry
+\param geometry2 \param_geometry
+*/
+template <typename Geometry1, typename RobustPolicy1, typename Geometry2>
+inline bool intersects(prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            Geometry2 const& geometry2)
+{
+    return ! geometry::disjoint(prepared1, geometry2);
+}
+
+/*!
+\brief Checks if a geometry and a prepared geometry intersect
+\ingroup prepared
+\param geometry1 \param_geometry
+\param prepared2 the prepared geometry
+*/
+template <typename Geometry1, typename Geometry2, typename RobustPolicy2>
+inline bool intersects(Geometry1 const& geometry1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2)
+{
+    return ! geometry::disjoint(geometry1, prepared2);
+}
+
+template
+<
+    typename Geometry1, typename RobustPolicy1,
+    typename Geometry2, typename RobustPolicy2
+>
+inline bool intersects(prepared_geometry<Geometry1, RobustPolicy1> const& prepared1,
+            prepared_geometry<Geometry2, RobustPolicy2> const& prepared2)
+{
+    return ! geometry::disjoint(prepared1, prepared2.geometry());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
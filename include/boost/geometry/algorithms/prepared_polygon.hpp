@@ -0,0 +1,350 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARED_POLYGON_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARED_POLYGON_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/multi/core/ring_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/within/box_band_index.hpp>
+#include <boost/geometry/algorithms/detail/within/ring_band_index.hpp>
+
+#include <boost/geometry/strategies/within.hpp>
+#include <boost/geometry/strategies/agnostic/point_in_poly_winding.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared_polygon
+{
+
+
+template <typename Geometry>
+struct default_strategy
+{
+    typedef typename geometry::point_type<Geometry>::type point_type;
+
+    typedef typename strategy::within::services::default_strategy
+        <
+            point_tag,
+            typename tag<Geometry>::type,
+            point_tag,
+            areal_tag,
+            typename tag_cast
+                <
+                    typename cs_tag<point_type>::type, spherical_tag
+                >::type,
+            typename tag_cast
+                <
+                    typename cs_tag<point_type>::type, spherical_tag
+                >::type,
+            point_type,
+            Geometry
+        >::type type;
+};
+
+
+// Range of rings: exterior ring, followed by the interior rings
+struct polygon_entry
+{
+    std::size_t first;
+    std::size_t count;
+};
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct add_rings
+    : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct add_rings<Ring, ring_tag>
+{
+    template <typename Rings, typename Entries>
+    static inline void apply(Ring const& ring, Rings& rings, Entries& entries)
+    {
+        typedef typename boost::range_value<Rings>::type index_type;
+
+        polygon_entry entry;
+        entry.first = rings.size();
+        entry.count = 1;
+        rings.push_back(index_type(ring));
+        entries.push_back(entry);
+    }
+};
+
+template <typename Polygon>
+struct add_rings<Polygon, polygon_tag>
+{
+    template <typename Rings, typename Entries>
+    static inline void apply(Polygon const& polygon, Rings& rings, Entries& entries)
+    {
+        typedef typename boost::range_value<Rings>::type index_type;
+
+        polygon_entry entry;
+        entry.first = rings.size();
+        rings.push_back(index_type(exterior_ring(polygon)));
+
+        typename interior_return_type<Polygon const>::type
+            interiors = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(interiors);
+             it != boost::end(interiors);
+             ++it)
+        {
+            rings.push_back(index_type(*it));
+        }
+
+        entry.count = rings.size() - entry.first;
+        entries.push_back(entry);
+    }
+};
+
+template <typename MultiPolygon>
+struct add_rings<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Rings, typename Entries>
+    static inline void apply(MultiPolygon const& multi, Rings& rings, Entries& entries)
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi);
+             it != boost::end(multi);
+             ++it)
+        {
+            add_rings<polygon_type>::apply(*it, rings, entries);
+        }
+    }
+};
+
+
+// Visits the polygons whose envelope contains the point, until the point
+// is found in the interior or on the boundary of one of them
+template <typename Prepared, typename Point>
+struct polygon_visitor
+{
+    inline polygon_visitor(Prepared const& prepared, Point const& point)
+        : m_prepared(prepared)
+        , m_point(point)
+        , code(-1)
+    {}
+
+    inline bool operator()(std::size_t index)
+    {
+        code = m_prepared.apply(m_point, index);
+        return code < 0;
+    }
+
+    Prepared const& m_prepared;
+    Point const& m_point;
+    int code;
+};
+
+
+}} // namespace detail::prepared_polygon
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Areal geometry prepared for repeated point-in-polygon queries
+\ingroup prepared
+\details The segments of each ring are indexed in horizontal bands. A point
+    is only compared with the segments of the band it is located in, instead
+    of with all segments of the ring. For rings without many long segments
+    a query takes amortized constant time. The results are the same as those
+    of within and covered_by with the default strategy. The envelopes of the
+    polygons are indexed in bands as well, such that a point is only
+    compared with the polygons whose envelope contains it.
+\tparam Geometry \tparam_geometry (ring, polygon or multi-polygon)
+\tparam Strategy point-in-polygon strategy, applied per segment
+\note The prepared polygon copies the points, it does not refer to the geometry
+*/
+template
+<
+    typename Geometry,
+    typename Strategy = typename detail::prepared_polygon::default_strategy
+        <
+            Geometry
+        >::type
+>
+class prepared_polygon
+{
+    typedef typename ring_type<Geometry>::type ring_type;
+    typedef detail::within::ring_band_index<ring_type, Strategy> index_type;
+    typedef detail::within::box_band_index
+        <
+            model::box<typename geometry::point_type<Geometry>::type>
+        > polygon_index_type;
+
+    template <typename Prepared, typename Point>
+    friend struct detail::prepared_polygon::polygon_visitor;
+
+public :
+    typedef Geometry geometry_type;
+    typedef Strategy strategy_type;
+
+    explicit inline prepared_polygon(Geometry const& geometry,
+                Strategy const& strategy = Strategy())
+        : m_strategy(strategy)
+    {
+        concept::check<Geometry const>();
+
+        detail::prepared_polygon::add_rings
+            <
+                Geometry
+            >::apply(geometry, m_rings, m_polygons);
+
+        for (std::size_t i = 0; i < m_polygons.size(); i++)
+        {
+            index_type const& exterior = m_rings[m_polygons[i].first];
+            if (exterior.valid())
+            {
+                m_polygon_index.add(exterior.envelope(), i);
+            }
+        }
+        m_polygon_index.build();
+    }
+
+    /*!
+    \brief Returns 1 if the point is in the interior, 0 if it is on the
+        boundary, and -1 if it is in the exterior
+    */
+    template <typename Point>
+    inline int apply(Point const& point) const
+    {
+        detail::prepared_polygon::polygon_visitor
+            <
+                prepared_polygon, Point
+            > visitor(*this, point);
+        m_polygon_index.apply(point, visitor);
+        return visitor.code;
+    }
+
+private :
+    template <typename Point>
+    inline int apply(Point const& point, std::size_t index) const
+    {
+        detail::prepared_polygon::polygon_entry const& entry
+            = m_polygons[index];
+        int const code = m_rings[entry.first].apply(point, m_strategy);
+        if (code == 1)
+        {
+            for (std::size_t i = 1; i < entry.count; i++)
+            {
+                int const interior_code
+                    = m_rings[entry.first + i].apply(point, m_strategy);
+                if (interior_code != -1)
+                {
+                    // If 0, return 0 (touch)
+                    // If 1 (inside hole) return -1 (outside polygon)
+                    return -interior_code;
+                }
+            }
+        }
+        return code;
+    }
+
+    Strategy m_strategy;
+    std::vector<index_type> m_rings;
+    std::vector<detail::prepared_polygon::polygon_entry> m_polygons;
+    polygon_index_type m_polygon_index;
+};
+
+
+/*!
+\brief Checks if a point is within a prepared polygon
+\ingroup prepared
+\param point \param_geometry
+\param prepared the prepared polygon
+\return true if the point is in the interior of the polygon
+*/
+template <typename Point, typename Geometry, typename Strategy>
+inline bool within(Point const& point,
+            prepared_polygon<Geometry, Strategy> const& prepared)
+{
+    concept::check<Point const>();
+    return prepared.apply(point) == 1;
+}
+
+
+/*!
+\brief Checks if a point is covered by a prepared polygon
+\ingroup prepared
+\param point \param_geometry
+\param prepared the prepared polygon
+\return true if the point is in the interior or on the boundary of the polygon
+*/
+template <typename Point, typename Geometry, typename Strategy>
+inline bool covered_by(Point const& point,
+            prepared_polygon<Geometry, Strategy> const& prepared)
+{
+    concept::check<Point const>();
+    return prepared.apply(point) >= 0;
+}
+
+
+/*!
+\brief Checks if a point intersects a prepared polygon
+\ingroup prepared
+\param point \param_geometry
+\param prepared the prepared polygon
+\return true if the point is in the interior or on the boundary of the polygon
+*/
+template <typename Point, typename Geometry, typename Strategy>
+inline bool intersects(Point const& point,
+            prepared_polygon<Geometry, Strategy> const& prepared)
+{
+    concept::check<Point const>();
+    return prepared.apply(point) >= 0;
+}
+
+
+/*!
+\brief Checks if a point is disjoint from a prepared polygon
+\ingroup prepared
+\param point \param_geometry
+\param prepared the prepared polygon
+\return true if the point is in the exterior of the polygon
+*/
+template <typename Point, typename Geometry, typename Strategy>
+inline bool disjoint(Point const& point,
+            prepared_polygon<Geometry, Strategy> const& prepared)
+{
+    concept::check<Point const>();
+    return prepared.apply(point) < 0;
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARED_POLYGON_HPP
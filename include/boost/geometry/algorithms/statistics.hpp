@@ -0,0 +1,378 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_STATISTICS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_STATISTICS_HPP
+
+
+#include <cstddef>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+
+#include <boost/geometry/strategies/area.hpp>
+#include <boost/geometry/strategies/centroid.hpp>
+#include <boost/geometry/strategies/default_area_result.hpp>
+#include <boost/geometry/strategies/default_length_result.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+
+#include <boost/geometry/views/closeable_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Selects the statistics calculated by calculate_statistics
+\ingroup statistics
+*/
+enum statistic
+{
+    statistic_area = 1,
+    statistic_centroid = 2,
+    statistic_perimeter = 4,
+    statistic_envelope = 8,
+    statistic_all = 15
+};
+
+
+/*!
+\brief Area, centroid, perimeter and envelope of an areal geometry
+\ingroup statistics
+\tparam Geometry \tparam_geometry
+*/
+template <typename Geometry>
+struct statistics
+{
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef typename default_area_result<Geometry>::type area_type;
+    typedef typename default_length_result<Geometry>::type length_type;
+    typedef model::box<point_type> box_type;
+
+    area_type area;
+    point_type centroid;
+    length_type perimeter;
+    box_type envelope;
+
+    inline statistics()
+        : area()
+        , perimeter()
+    {}
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace statistics
+{
+
+
+// The default strategies and the states of the strategies having a state
+template <typename Geometry>
+struct calculator
+{
+    typedef geometry::statistics<Geometry> result_type;
+    typedef typename result_type::point_type point_type;
+    typedef typename result_type::area_type area_type;
+    typedef typename result_type::length_type length_type;
+
+    typedef typename strategy::area::services::default_strategy
+        <
+            typename cs_tag<point_type>::type,
+            point_type
+        >::type area_strategy_type;
+
+    typedef typename strategy::centroid::services::default_strategy
+        <
+            typename cs_tag<point_type>::type,
+            areal_tag,
+            dimension<point_type>::type::value,
+            point_type,
+            Geometry
+        >::type centroid_strategy_type;
+
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, point_tag, point_type
+        >::type distance_strategy_type;
+
+    inline calculator(int selection)
+        : with_area((selection & statistic_area) != 0)
+        , with_centroid((selection & statistic_centroid) != 0)
+        , with_perimeter((selection & statistic_perimeter) != 0)
+        , with_envelope((selection & statistic_envelope) != 0)
+    {}
+
+    // Walks once through the segments of a ring, feeding the selected
+    // strategies. The ring area and perimeter are returned per ring and
+    // summed per polygon, as area and perimeter do.
+    template <bool Exterior, typename Ring>
+    inline void apply(Ring const& ring, result_type& result,
+            area_type& area, length_type& perimeter)
+    {
+        static const closure_selector closure = geometry::closure<Ring>::value;
+
+        typedef typename closeable_view<Ring const, closure>::type view_type;
+        typedef typename boost::range_iterator
+            <
+                view_type const
+            >::type iterator_type;
+
+        // As in area: a ring without enough points has no area
+        bool const ring_area = with_area
+            && boost::size(ring)
+                >= core_detail::closure::minimum_ring_size<closure>::value;
+        bool const ring_envelope = Exterior && with_envelope;
+
+        typename area_strategy_type::state_type area_state;
+        length_type sum = length_type();
+
+        view_type view(ring);
+        iterator_type it = boost::begin(view);
+        iterator_type end = boost::end(view);
+        if (it == end)
+        {
+            area = area_type();
+            perimeter = sum;
+            return;
+        }
+
+        if (ring_envelope)
+        {
+            geometry::expand(result.envelope, *it);
+        }
+
+        for (iterator_type previous = it++;
+            it != end;
+            ++previous, ++it)
+        {
+            if (ring_area)
+            {
+                area_strategy.apply(*previous, *it, area_state);
+            }
+            if (with_centroid)
+            {
+                centroid_strategy.apply(*previous, *it, centroid_state);
+            }
+            if (with_perimeter)
+            {
+                sum += distance_strategy.apply(*previous, *it);
+            }
+            if (ring_envelope)
+            {
+                geometry::expand(result.envelope, *it);
+            }
+        }
+
+        area = ring_area ? area_strategy.result(area_state) : area_type();
+        if (geometry::point_order<Ring>::value == counterclockwise)
+        {
+            // area walks counter clockwise rings backwards
+            area = -area;
+        }
+        perimeter = sum;
+    }
+
+    template <typename Polygon>
+    inline void apply_polygon(Polygon const& polygon, result_type& result,
+            area_type& area, length_type& perimeter)
+    {
+        apply<true>(exterior_ring(polygon), result, area, perimeter);
+
+        area_type interior_area = area_type();
+        length_type interior_perimeter = length_type();
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            area_type ring_area;
+            length_type ring_perimeter;
+            apply<false>(*it, result, ring_area, ring_perimeter);
+            interior_area += ring_area;
+            interior_perimeter += ring_perimeter;
+        }
+
+        area += interior_area;
+        perimeter += interior_perimeter;
+    }
+
+    inline void finish(result_type& result, bool centroid_ok)
+    {
+        if (with_centroid && centroid_ok)
+        {
+            centroid_strategy.result(centroid_state, result.centroid);
+        }
+    }
+
+    bool const with_area;
+    bool const with_centroid;
+    bool const with_perimeter;
+    bool const with_envelope;
+
+    area_strategy_type area_strategy;
+    centroid_strategy_type centroid_strategy;
+    distance_strategy_type distance_strategy;
+    typename centroid_strategy_type::state_type centroid_state;
+};
+
+
+struct statistics_ring
+{
+    template <typename Ring>
+    static inline void apply(Ring const& ring,
+            geometry::statistics<Ring>& result, int selection)
+    {
+        calculator<Ring> calc(selection);
+        bool const centroid_ok = ! calc.with_centroid
+            || detail::centroid::range_ok(ring, result.centroid);
+
+        calc.template apply<true>(ring, result, result.area, result.perimeter);
+        calc.finish(result, centroid_ok);
+    }
+};
+
+
+struct statistics_polygon
+{
+    template <typename Polygon>
+    static inline void apply(Polygon const& polygon,
+            geometry::statistics<Polygon>& result, int selection)
+    {
+        calculator<Polygon> calc(selection);
+        bool const centroid_ok = ! calc.with_centroid
+            || detail::centroid::range_ok(exterior_ring(polygon),
+                    result.centroid);
+
+        calc.apply_polygon(polygon, result, result.area, result.perimeter);
+        calc.finish(result, centroid_ok);
+    }
+};
+
+
+struct statistics_multi_polygon
+{
+    template <typename MultiPolygon>
+    static inline void apply(MultiPolygon const& multi,
+            geometry::statistics<MultiPolygon>& result, int selection)
+    {
+        typedef calculator<MultiPolygon> calculator_type;
+        calculator_type calc(selection);
+
+#if ! defined(BOOST_GEOMETRY_CENTROID_NO_THROW)
+        if (calc.with_centroid && geometry::num_points(multi) == 0)
+        {
+            throw centroid_exception();
+        }
+#endif
+
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi);
+            it != boost::end(multi);
+            ++it)
+        {
+            typename calculator_type::area_type area;
+            typename calculator_type::length_type perimeter;
+            calc.apply_polygon(*it, result, area, perimeter);
+            result.area += area;
+            result.perimeter += perimeter;
+        }
+        calc.finish(result, true);
+    }
+};
+
+
+}} // namespace detail::statistics
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct statistics : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct statistics<Ring, ring_tag>
+    : detail::statistics::statistics_ring
+{};
+
+template <typename Polygon>
+struct statistics<Polygon, polygon_tag>
+    : detail::statistics::statistics_polygon
+{};
+
+template <typename MultiPolygon>
+struct statistics<MultiPolygon, multi_polygon_tag>
+    : detail::statistics::statistics_multi_polygon
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Calculates area, centroid, perimeter and/or envelope of an areal
+    geometry in one pass
+\ingroup statistics
+\details The selected statistics are calculated while walking once through
+    the coordinates, using the default strategies of area, centroid,
+    perimeter and envelope. The results are the same as those of these
+    algorithms, apart from rounding: counter clockwise rings are walked
+    forwards and not backwards, as area does.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param result the statistics, of which the selected members are assigned
+\param selection combination of the statistic values to calculate
+*/
+template <typename Geometry>
+inline void calculate_statistics(Geometry const& geometry,
+            statistics<Geometry>& result,
+            int selection = statistic_all)
+{
+    concept::check<Geometry const>();
+
+    result.area = typename statistics<Geometry>::area_type();
+    result.perimeter = typename statistics<Geometry>::length_type();
+    geometry::assign_inverse(result.envelope);
+
+    dispatch::statistics<Geometry>::apply(geometry, result, selection);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_STATISTICS_HPP
@@ -0,0 +1,222 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_UNION_ALL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_UNION_ALL_HPP
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+
+#include <boost/geometry/multi/algorithms/envelope.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace union_all
+{
+
+
+template <std::size_t Dimension, typename Boxes>
+struct less_center
+{
+    explicit inline less_center(Boxes const& boxes)
+        : m_boxes(boxes)
+    {}
+
+    inline bool operator()(std::size_t left, std::size_t right) const
+    {
+        // The sum of the corners is compared, which orders as the center
+        return geometry::get<min_corner, Dimension>(m_boxes[left])
+                + geometry::get<max_corner, Dimension>(m_boxes[left])
+             < geometry::get<min_corner, Dimension>(m_boxes[right])
+                + geometry::get<max_corner, Dimension>(m_boxes[right]);
+    }
+
+    Boxes const& m_boxes;
+};
+
+
+// Orders the geometries as the leaves of a Sort-Tile-Recursive tree: the
+// centers are sorted in x-direction, divided into vertical slices, which
+// are sorted in y-direction, alternating upwards and downwards. Neighbours
+// in this order are therefore mostly neighbours in space.
+template <typename Boxes>
+inline void sort_tile(Boxes const& boxes, std::vector<std::size_t>& order)
+{
+    std::size_t const count = boost::size(boxes);
+    order.resize(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        order[i] = i;
+    }
+    if (count <= 2)
+    {
+        return;
+    }
+
+    std::sort(order.begin(), order.end(), less_center<0, Boxes>(boxes));
+
+    std::size_t const slice_count = static_cast<std::size_t>(
+            std::ceil(std::sqrt(static_cast<double>(count))));
+    std::size_t const slice_size = (count + slice_count - 1) / slice_count;
+
+    bool reverse = false;
+    for (std::size_t first = 0; first < count; first += slice_size)
+    {
+        std::vector<std::size_t>::iterator begin = order.begin() + first;
+        std::vector<std::size_t>::iterator end
+            = order.begin() + (std::min)(first + slice_size, count);
+
+        std::sort(begin, end, less_center<1, Boxes>(boxes));
+        if (reverse)
+        {
+            std::reverse(begin, end);
+        }
+        reverse = ! reverse;
+    }
+}
+
+
+// Unions the geometries in the specified part of the order bottom-up, in
+// pairs. Each level unions geometries of about the same size, instead of
+// adding them one by one to a growing result.
+template
+<
+    typename Geometries, typename Boxes,
+    typename MultiPolygon, typename Box
+>
+inline void cascade(Geometries const& geometries, Boxes const& boxes,
+        std::vector<std::size_t> const& order,
+        std::size_t first, std::size_t last,
+        MultiPolygon& result, Box& box)
+{
+    if (last - first == 1)
+    {
+        geometry::convert(range::at(geometries, order[first]), result);
+        box = boxes[order[first]];
+        return;
+    }
+
+    std::size_t const middle = first + (last - first) / 2;
+
+    MultiPolygon result1, result2;
+    Box box2;
+    cascade(geometries, boxes, order, first, middle, result1, box);
+    cascade(geometries, boxes, order, middle, last, result2, box2);
+
+    if (detail::disjoint::disjoint_box_box(box, box2))
+    {
+        // The polygons cannot overlap, the union is just their collection
+        result.swap(result1);
+        result.insert(result.end(),
+                boost::begin(result2), boost::end(result2));
+    }
+    else
+    {
+        geometry::union_(result1, result2, result);
+    }
+    geometry::expand(box, box2);
+}
+
+
+}} // namespace detail::union_all
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Combines all geometries of a range into one areal geometry
+\ingroup union
+\details The geometries are unioned in pairs, bottom-up in a binary tree,
+    of which the leaves are ordered spatially (as a packed R-tree).
+    Unioning N geometries therefore takes about log(N) levels of unions of
+    neighbouring geometries, which is much faster than adding the
+    geometries one by one to a growing result. Geometries of which the
+    envelopes are disjoint are collected without overlay.
+\note The two halves of each node are independent, so a range of
+    geometries may also be split by the caller, for example by
+    boost::make_iterator_range, unioned concurrently, and the results
+    unioned by union_all again.
+\tparam Geometries random access range of polygons or multi-polygons
+\tparam Collection output collection, either a multi-geometry,
+    or a std::vector<Geometry> / std::deque<Geometry> etc
+\param geometries geometries to combine
+\param output_collection the output collection, to which the polygons of
+    the union are added
+*/
+template <typename Geometries, typename Collection>
+inline void union_all(Geometries const& geometries,
+            Collection& output_collection)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_value<Collection>::type polygon_type;
+    typedef model::multi_polygon<polygon_type> multi_polygon_type;
+    typedef model::box
+        <
+            typename geometry::point_type<geometry_type>::type
+        > box_type;
+
+    concept::check<geometry_type const>();
+    concept::check<polygon_type>();
+
+    std::size_t const count = boost::size(geometries);
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::vector<box_type> boxes(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        geometry::envelope(range::at(geometries, i), boxes[i]);
+    }
+
+    std::vector<std::size_t> order;
+    detail::union_all::sort_tile(boxes, order);
+
+    multi_polygon_type result;
+    box_type box;
+    detail::union_all::cascade(geometries, boxes, order, 0, count,
+            result, box);
+
+    for (typename boost::range_iterator<multi_polygon_type const>::type
+            it = boost::begin(result);
+         it != boost::end(result);
+         ++it)
+    {
+        range::push_back(output_collection, *it);
+    }
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_UNION_ALL_HPP
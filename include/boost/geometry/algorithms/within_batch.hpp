@@ -0,0 +1,342 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_WITHIN_BATCH_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_WITHIN_BATCH_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+
+#include <boost/geometry/strategies/cartesian/point_in_poly_crossings_multiply.hpp>
+#include <boost/geometry/strategies/cartesian/point_in_poly_franklin.hpp>
+
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+#include <boost/geometry/views/closeable_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace within_batch
+{
+
+
+// Number of points classified together. The points are classified
+// against one edge at a time, in a loop without branches, which
+// compilers can vectorize
+static const std::size_t block_size = 64;
+
+
+// The edges of all rings, with the coordinates stored per component
+template <typename T>
+struct edges
+{
+    std::vector<T> x0, y0, x1, y1;
+
+    template <typename Point>
+    inline void add(Point const& p0, Point const& p1)
+    {
+        x0.push_back(geometry::get<0>(p0));
+        y0.push_back(geometry::get<1>(p0));
+        x1.push_back(geometry::get<0>(p1));
+        y1.push_back(geometry::get<1>(p1));
+    }
+
+    inline std::size_t size() const
+    {
+        return x0.size();
+    }
+};
+
+
+template <typename Ring, typename Edges>
+inline void add_ring(Ring const& ring, Edges& edges)
+{
+    typedef typename closeable_view
+        <
+            Ring const, geometry::closure<Ring>::value
+        >::type view_type;
+    typedef typename boost::range_iterator<view_type const>::type iterator_type;
+
+    view_type view(ring);
+    iterator_type it = boost::begin(view);
+    iterator_type end = boost::end(view);
+    if (it == end)
+    {
+        return;
+    }
+    for (iterator_type previous = it++; it != end; ++previous, ++it)
+    {
+        edges.add(*previous, *it);
+    }
+}
+
+
+// Collects the edges of all rings. For valid geometries, the parity of the
+// number of crossings with all rings (including holes, and all polygons of
+// a multi-polygon) tells if a point is inside.
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct collect_edges
+    : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct collect_edges<Ring, ring_tag>
+{
+    template <typename Edges>
+    static inline void apply(Ring const& ring, Edges& edges)
+    {
+        add_ring(ring, edges);
+    }
+};
+
+template <typename Polygon>
+struct collect_edges<Polygon, polygon_tag>
+{
+    template <typename Edges>
+    static inline void apply(Polygon const& polygon, Edges& edges)
+    {
+        add_ring(exterior_ring(polygon), edges);
+
+        typename interior_return_type<Polygon const>::type
+            interiors = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(interiors);
+             it != boost::end(interiors);
+             ++it)
+        {
+            add_ring(*it, edges);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct collect_edges<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Edges>
+    static inline void apply(MultiPolygon const& multi, Edges& edges)
+    {
+        typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi);
+             it != boost::end(multi);
+             ++it)
+        {
+            collect_edges<polygon_type>::apply(*it, edges);
+        }
+    }
+};
+
+
+// Crossing kernels, toggling the flag of each point of a block when the
+// edge is crossed by a ray from that point. They give the same results as
+// the per-point strategies.
+template <typename Strategy>
+struct crossing_kernel
+{};
+
+template <typename Point, typename PointOfSegment, typename CalculationType>
+struct crossing_kernel
+    <
+        strategy::within::crossings_multiply
+            <
+                Point, PointOfSegment, CalculationType
+            >
+    >
+{
+    typedef typename select_calculation_type
+        <
+            Point, PointOfSegment, CalculationType
+        >::type calculation_type;
+
+    static inline void apply(calculation_type const& x0,
+                calculation_type const& y0,
+                calculation_type const& x1,
+                calculation_type const& y1,
+                calculation_type const* tx, calculation_type const* ty,
+                unsigned char* inside, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            bool const yflag0 = y0 >= ty[i];
+            bool const yflag1 = y1 >= ty[i];
+            bool const side
+                = ((y1 - ty[i]) * (x0 - x1) >= (x1 - tx[i]) * (y0 - y1))
+                    == yflag1;
+            inside[i] ^= static_cast<unsigned char>((yflag0 != yflag1) & side);
+        }
+    }
+};
+
+template <typename Point, typename PointOfSegment, typename CalculationType>
+struct crossing_kernel
+    <
+        strategy::within::franklin
+            <
+                Point, PointOfSegment, CalculationType
+            >
+    >
+{
+    typedef typename select_calculation_type
+        <
+            Point, PointOfSegment, CalculationType
+        >::type calculation_type;
+
+    static inline void apply(calculation_type const& x1,
+                calculation_type const& y1,
+                calculation_type const& x2,
+                calculation_type const& y2,
+                calculation_type const* px, calculation_type const* py,
+                unsigned char* inside, std::size_t count)
+    {
+        // Horizontal edges are never crossed, avoid dividing by zero
+        calculation_type const dy = y1 == y2 ? calculation_type(1) : y1 - y2;
+        calculation_type const dx = x1 - x2;
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            bool const crosses_y = (y2 <= py[i]) != (y1 <= py[i]);
+            bool const left = px[i] < dx * (py[i] - y2) / dy + x2;
+            inside[i] ^= static_cast<unsigned char>(crosses_y & left);
+        }
+    }
+};
+
+
+template <typename Points, typename Geometry, typename Bitmap, typename Strategy>
+inline void apply(Points const& points, Geometry const& geometry,
+            Bitmap& result, Strategy const& )
+{
+    typedef crossing_kernel<Strategy> kernel_type;
+    typedef typename kernel_type::calculation_type calculation_type;
+    typedef typename boost::range_iterator<Points const>::type iterator_type;
+
+    edges<calculation_type> all_edges;
+    collect_edges<Geometry>::apply(geometry, all_edges);
+    std::size_t const edge_count = all_edges.size();
+
+    result.resize(boost::size(points));
+
+    calculation_type tx[block_size];
+    calculation_type ty[block_size];
+    unsigned char inside[block_size];
+
+    std::size_t index = 0;
+    iterator_type it = boost::begin(points);
+    iterator_type const end = boost::end(points);
+    while (it != end)
+    {
+        std::size_t count = 0;
+        for ( ; it != end && count < block_size; ++it, ++count)
+        {
+            tx[count] = geometry::get<0>(*it);
+            ty[count] = geometry::get<1>(*it);
+            inside[count] = 0;
+        }
+
+        for (std::size_t e = 0; e < edge_count; e++)
+        {
+            kernel_type::apply(all_edges.x0[e], all_edges.y0[e],
+                    all_edges.x1[e], all_edges.y1[e],
+                    tx, ty, inside, count);
+        }
+
+        for (std::size_t i = 0; i < count; i++, index++)
+        {
+            result[index] = inside[i] != 0;
+        }
+    }
+}
+
+
+}} // namespace detail::within_batch
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Checks for each point of a range if it is within a geometry \brief_strategy
+\ingroup within
+\details The points are classified in blocks, against one edge at a time,
+    by a crossing kernel without branches. This is considerably faster than
+    calling within for each point separately.
+\tparam Points range of points
+\tparam Geometry \tparam_geometry (ring, polygon or multi-polygon)
+\tparam Bitmap container of booleans, having resize and operator[],
+    for example std::vector<bool>
+\tparam Strategy crossings_multiply or franklin
+\param points points to classify
+\param geometry \param_geometry
+\param result resized to the number of points, bit i is set if point i
+    is within the geometry
+\param strategy \param_strategy{within}
+\note As the used strategies, this does not work for points on the border
+\note The geometry should be valid: holes and polygons are combined by
+    the parity of the crossings
+*/
+template <typename Points, typename Geometry, typename Bitmap, typename Strategy>
+inline void within_batch(Points const& points, Geometry const& geometry,
+            Bitmap& result, Strategy const& strategy)
+{
+    concept::check<Geometry const>();
+
+    detail::within_batch::apply(points, geometry, result, strategy);
+}
+
+
+/*!
+\brief Checks for each point of a range if it is within a geometry
+\ingroup within
+\details Uses the crossings_multiply strategy, see the overload with strategy
+\tparam Points range of points
+\tparam Geometry \tparam_geometry (ring, polygon or multi-polygon)
+\tparam Bitmap container of booleans, having resize and operator[],
+    for example std::vector<bool>
+\param points points to classify
+\param geometry \param_geometry
+\param result resized to the number of points, bit i is set if point i
+    is within the geometry
+*/
+template <typename Points, typename Geometry, typename Bitmap>
+inline void within_batch(Points const& points, Geometry const& geometry,
+            Bitmap& result)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+    typedef strategy::within::crossings_multiply
+        <
+            point_type,
+            typename geometry::point_type<Geometry>::type
+        > strategy_type;
+
+    within_batch(points, geometry, result, strategy_type());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_WITHIN_BATCH_HPP
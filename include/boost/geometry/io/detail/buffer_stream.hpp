@@ -0,0 +1,270 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DETAIL_BUFFER_STREAM_HPP
+#define BOOST_GEOMETRY_IO_DETAIL_BUFFER_STREAM_HPP
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/sign.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/io/detail/shortest_digits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace io
+{
+
+template <typename Buffer>
+inline void append(Buffer& buffer, char const* first, char const* last)
+{
+    buffer.insert(buffer.end(), first, last);
+}
+
+// Writes the digits of an integer, with a decimal point before the last
+// decimals digits, returns the start of the written characters
+inline char* format_decimal(boost::uint64_t value, int decimals, char* end)
+{
+    char* it = end;
+    int count = 0;
+    do
+    {
+        if (count++ == decimals && decimals > 0)
+        {
+            *--it = '.';
+        }
+        *--it = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    while (value > 0 || count <= decimals);
+    return it;
+}
+
+
+/*!
+\brief Internal, formats a coordinate value, appending it to a buffer
+\details Fundamental floating point types are by default formatted with the
+    shortest representation which reads back to the same value (see
+    shortest_digits). With a
+    precision, they are formatted as a stream would do with that precision.
+    Integral types are formatted directly, other types by a stream.
+*/
+template
+<
+    typename T,
+    bool IsFloatingPoint =
+        boost::is_same<T, double>::value || boost::is_same<T, float>::value,
+    bool IsIntegral = boost::is_integral<T>::value
+>
+struct format_number
+{
+    template <typename Buffer>
+    static inline void apply(T const& value, int precision, Buffer& buffer)
+    {
+        std::ostringstream out;
+        if (precision > 0)
+        {
+            out.precision(precision);
+        }
+        out << value;
+        std::string const s = out.str();
+        append(buffer, s.data(), s.data() + s.size());
+    }
+};
+
+template <typename T>
+struct format_number<T, true, false>
+{
+    static const int max_digits10
+        = 2 + std::numeric_limits<T>::digits * 30103 / 100000;
+
+    template <typename Buffer>
+    static inline void apply(T const& value, int precision, Buffer& buffer)
+    {
+        char text[64];
+
+        if (precision > 0 || ! boost::math::isfinite(value))
+        {
+            append(buffer, text, text + print(value, (std::min)(precision, 40), text));
+            return;
+        }
+
+        char* it = text;
+        if (boost::math::signbit(value))
+        {
+            *it++ = '-';
+        }
+        if (value == 0)
+        {
+            *it++ = '0';
+            append(buffer, text, it);
+            return;
+        }
+
+        char digits[24];
+        int exponent = 0;
+        int const n = shortest_digits(value < 0 ? -value : value,
+                                      digits, exponent);
+
+        // Formatted as a stream does with max_digits10 precision, but
+        // without trailing zeros: with an exponent if it is below -4 or
+        // if the integral part has too many digits
+        int const point = n + exponent;
+        if (point - 1 < -4 || point - 1 >= max_digits10)
+        {
+            *it++ = digits[0];
+            if (n > 1)
+            {
+                *it++ = '.';
+                it = std::copy(digits + 1, digits + n, it);
+            }
+            *it++ = 'e';
+            *it++ = point - 1 < 0 ? '-' : '+';
+            int const e = point - 1 < 0 ? 1 - point : point - 1;
+            if (e < 10)
+            {
+                *it++ = '0';
+            }
+            char* const end = text + sizeof(text);
+            char* const first = format_decimal(e, 0, end);
+            it = std::copy(first, end, it);
+        }
+        else if (point >= n)
+        {
+            it = std::copy(digits, digits + n, it);
+            it = std::fill_n(it, point - n, '0');
+        }
+        else if (point > 0)
+        {
+            it = std::copy(digits, digits + point, it);
+            *it++ = '.';
+            it = std::copy(digits + point, digits + n, it);
+        }
+        else
+        {
+            *it++ = '0';
+            *it++ = '.';
+            it = std::fill_n(it, -point, '0');
+            it = std::copy(digits, digits + n, it);
+        }
+        append(buffer, text, it);
+    }
+
+private :
+    // Formats as std::ostream does, independent of the locale
+    static inline int print(T const& value, int precision, char* text)
+    {
+        int const n = std::sprintf(text, "%.*g", precision,
+                            static_cast<double>(value));
+        for (int i = 0; i < n; i++)
+        {
+            if (text[i] == ',')
+            {
+                text[i] = '.';
+            }
+        }
+        return n;
+    }
+};
+
+template <typename T>
+struct format_number<T, false, true>
+{
+    template <typename Buffer>
+    static inline void apply(T const& value, int , Buffer& buffer)
+    {
+        char text[32];
+        char* const end = text + sizeof(text);
+        bool const negative = value < 0;
+
+        // Negated as unsigned, such that the minimum value is handled
+        boost::uint64_t const magnitude = negative
+            ? 0 - static_cast<boost::uint64_t>(value)
+            : static_cast<boost::uint64_t>(value);
+
+        char* first = format_decimal(magnitude, 0, end);
+        if (negative)
+        {
+            *--first = '-';
+        }
+        append(buffer, first, end);
+    }
+};
+
+
+/*!
+\brief Internal, output stream appending to a buffer of characters
+\details Supports the subset of std::ostream used by the WKT and DSV writers,
+    without locales, virtual calls or flushing. Coordinates are formatted
+    by format_number.
+\tparam Buffer growable range of characters, for example std::string
+    or std::vector<char>
+*/
+template <typename Buffer>
+class buffer_stream
+{
+public :
+    inline buffer_stream(Buffer& buffer, int precision)
+        : m_buffer(buffer)
+        , m_precision(precision)
+    {}
+
+    inline buffer_stream& operator<<(char const* s)
+    {
+        append(m_buffer, s, s + std::strlen(s));
+        return *this;
+    }
+
+    inline buffer_stream& operator<<(std::string const& s)
+    {
+        append(m_buffer, s.data(), s.data() + s.size());
+        return *this;
+    }
+
+    inline buffer_stream& operator<<(char c)
+    {
+        append(m_buffer, &c, &c + 1);
+        return *this;
+    }
+
+    template <typename T>
+    inline buffer_stream& operator<<(T const& value)
+    {
+        format_number<T>::apply(value, m_precision, m_buffer);
+        return *this;
+    }
+
+    inline void flush()
+    {}
+
+private :
+    Buffer& m_buffer;
+    int m_precision;
+};
+
+
+}} // namespace detail::io
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_DETAIL_BUFFER_STREAM_HPP
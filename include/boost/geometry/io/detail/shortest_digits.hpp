@@ -0,0 +1,275 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DETAIL_SHORTEST_DIGITS_HPP
+#define BOOST_GEOMETRY_IO_DETAIL_SHORTEST_DIGITS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/cstdint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace io
+{
+
+// Generates the digits of floating point values with the Grisu2 algorithm
+// of Florian Loitsch ("Printing Floating-Point Numbers Quickly and
+// Accurately with Integers", PLDI 2010). The digits always read back to
+// the same value and are, apart from rare cases, the shortest doing so.
+// The digits are generated with 64-bit integer arithmetic. Floating point
+// is only used, exactly, to decompose the value (frexp, ldexp) and to
+// estimate the index of the cached power of ten.
+
+// Floating point value f * 2^e, with a 64-bit significand
+struct diy_fp
+{
+    boost::uint64_t f;
+    int e;
+
+    inline diy_fp(boost::uint64_t f_, int e_)
+        : f(f_), e(e_)
+    {}
+
+    inline diy_fp normalized() const
+    {
+        diy_fp result(f, e);
+        while ((result.f & (boost::uint64_t(1) << 63)) == 0)
+        {
+            result.f <<= 1;
+            result.e--;
+        }
+        return result;
+    }
+
+    // Upper 64 bits of the product, rounded
+    inline diy_fp operator*(diy_fp const& other) const
+    {
+        boost::uint64_t const mask = 0xffffffffu;
+        boost::uint64_t const a = f >> 32, b = f & mask;
+        boost::uint64_t const c = other.f >> 32, d = other.f & mask;
+        boost::uint64_t const ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+        boost::uint64_t const tmp = (bd >> 32) + (ad & mask) + (bc & mask)
+            + (boost::uint64_t(1) << 31);
+        return diy_fp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32),
+                      e + other.e + 64);
+    }
+};
+
+// Normalized powers of ten 10^k, for k = -348, -340, ..., 340
+inline diy_fp cached_power(int index)
+{
+    static boost::uint64_t const significands[] =
+        {
+            0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+            0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+            0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+            0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+            0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+            0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+            0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+            0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+            0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+            0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+            0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+            0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+            0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+            0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+            0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+            0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+            0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+            0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+            0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+            0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+            0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+            0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+            0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+            0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+            0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+            0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+            0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+            0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+            0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+        };
+    static short const exponents[] =
+        {
+            -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+            -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+            -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+            -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+            -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+            109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+            375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+            641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+            907, 933, 960, 986, 1013, 1039, 1066
+        };
+    return diy_fp(significands[index], exponents[index]);
+}
+
+inline boost::uint64_t power_of_ten_integer(int n)
+{
+    static boost::uint64_t const powers[] =
+        {
+            1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+            10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+            100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+            100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+            100000000000000000ULL, 1000000000000000000ULL,
+            10000000000000000000ULL
+        };
+    return powers[n];
+}
+
+inline int count_decimal_digits(boost::uint32_t n)
+{
+    int count = 1;
+    for ( ; n >= 10; n /= 10)
+    {
+        count++;
+    }
+    return count;
+}
+
+// Moves the last digit towards the value, as long as it stays in the
+// interval of values reading back to the same value
+inline void grisu_round(char* digits, int length, boost::uint64_t delta,
+            boost::uint64_t rest, boost::uint64_t ten_kappa,
+            boost::uint64_t distance)
+{
+    while (rest < distance
+        && delta - rest >= ten_kappa
+        && (rest + ten_kappa < distance
+            || distance - rest > rest + ten_kappa - distance))
+    {
+        digits[length - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+// Generates digits of the upper boundary, until they are within delta
+inline void generate_digits(diy_fp const& w, diy_fp const& upper,
+            boost::uint64_t delta, char* digits, int& length, int& k)
+{
+    diy_fp const one(boost::uint64_t(1) << -upper.e, upper.e);
+    boost::uint64_t const distance = upper.f - w.f;
+    boost::uint32_t p1 = static_cast<boost::uint32_t>(upper.f >> -one.e);
+    boost::uint64_t p2 = upper.f & (one.f - 1);
+    int kappa = count_decimal_digits(p1);
+    length = 0;
+
+    while (kappa > 0)
+    {
+        boost::uint32_t const divisor
+            = static_cast<boost::uint32_t>(power_of_ten_integer(kappa - 1));
+        boost::uint32_t const d = p1 / divisor;
+        p1 %= divisor;
+        if (d > 0 || length > 0)
+        {
+            digits[length++] = static_cast<char>('0' + d);
+        }
+        kappa--;
+        boost::uint64_t const rest = (boost::uint64_t(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            k += kappa;
+            grisu_round(digits, length, delta, rest,
+                power_of_ten_integer(kappa) << -one.e, distance);
+            return;
+        }
+    }
+
+    for (;;)
+    {
+        p2 *= 10;
+        delta *= 10;
+        char const d = static_cast<char>(p2 >> -one.e);
+        if (d > 0 || length > 0)
+        {
+            digits[length++] = static_cast<char>('0' + d);
+        }
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta)
+        {
+            k += kappa;
+            grisu_round(digits, length, delta, p2, one.f,
+                -kappa < 20 ? distance * power_of_ten_integer(-kappa) : 0);
+            return;
+        }
+    }
+}
+
+/*!
+\brief Internal, generates the shortest digits of a positive finite
+    floating point value, such that value = digits * 10^exponent
+\details At most 17 digits are written (9 for float)
+\return number of digits
+*/
+template <typename T>
+inline int shortest_digits(T const& value, char* digits, int& exponent)
+{
+    static const int digits_count = std::numeric_limits<T>::digits;
+
+    // Decomposed as f * 2^e, with an integer f of the digits of T,
+    // or less digits for subnormal values
+    int e = 0;
+    std::frexp(value, &e);
+    e = (std::max)(e, static_cast<int>(std::numeric_limits<T>::min_exponent));
+    diy_fp const v(static_cast<boost::uint64_t>(
+                        std::ldexp(value, digits_count - e)),
+                   e - digits_count);
+    boost::uint64_t const hidden = boost::uint64_t(1) << (digits_count - 1);
+
+    // Boundaries halfway to the neighbouring values, with the same exponent.
+    // The lower neighbour of a power of two is closer.
+    diy_fp const upper = diy_fp((v.f << 1) + 1, v.e - 1).normalized();
+    diy_fp lower = v.f == hidden
+        ? diy_fp((v.f << 2) - 1, v.e - 2)
+        : diy_fp((v.f << 1) - 1, v.e - 1);
+    lower.f <<= lower.e - upper.e;
+    lower.e = upper.e;
+
+    // Scaled by a cached power of ten, such that the binary exponent
+    // of the upper boundary is in [-60, -32]
+    double const dk = (-61 - upper.e) * 0.30102999566398114 + 347;
+    int k = static_cast<int>(dk);
+    if (dk - k > 0)
+    {
+        k++;
+    }
+    int const index = (k >> 3) + 1;
+    int decimal_exponent = -(-348 + index * 8);
+    diy_fp const power = cached_power(index);
+
+    diy_fp const w = v.normalized() * power;
+    diy_fp scaled_upper = upper * power;
+    diy_fp scaled_lower = lower * power;
+    scaled_lower.f++;
+    scaled_upper.f--;
+
+    int length = 0;
+    generate_digits(w, scaled_upper, scaled_upper.f - scaled_lower.f,
+        digits, length, decimal_exponent);
+    exponent = decimal_exponent;
+    return length;
+}
+
+
+}} // namespace detail::io
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_DETAIL_SHORTEST_DIGITS_HPP
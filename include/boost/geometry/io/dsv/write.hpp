@@ -32,6 +32,8 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
+#include <boost/geometry/io/detail/buffer_stream.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -73,8 +75,8 @@ struct dsv_settings
 template <typename Point, std::size_t Dimension, std::size_t Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Point const& point,
             dsv_settings const& settings)
     {
@@ -91,8 +93,8 @@ struct stream_coordinate
 template <typename Point, std::size_t Count>
 struct stream_coordinate<Point, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&,
+    template <typename OutputStream>
+    static inline void apply(OutputStream&,
             Point const&,
             dsv_settings const& )
     {
@@ -111,8 +113,8 @@ template
 >
 struct stream_indexed
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -128,8 +130,8 @@ struct stream_indexed
 template <typename Geometry, std::size_t Index, std::size_t Count>
 struct stream_indexed<Geometry, Index, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, Geometry const&,
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, Geometry const&,
             dsv_settings const& )
     {
     }
@@ -141,8 +143,8 @@ struct stream_indexed<Geometry, Index, Count, Count>
 template <typename Point>
 struct dsv_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Point const& p,
             dsv_settings const& settings)
     {
@@ -159,8 +161,8 @@ struct dsv_point
 template <typename Range>
 struct dsv_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Range const& range,
             dsv_settings const& settings)
     {
@@ -201,8 +203,8 @@ private:
 template <typename Polygon>
 struct dsv_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly,
                 dsv_settings const& settings)
     {
@@ -229,8 +231,8 @@ struct dsv_per_index
 {
     typedef typename point_type<Geometry>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -248,8 +250,8 @@ struct dsv_indexed
 {
     typedef typename point_type<Geometry>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -362,8 +364,8 @@ struct dsv_multi
         >::type iterator;
 
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 MultiGeometry const& multi,
                 dsv_settings const& settings)
     {
@@ -426,6 +428,47 @@ inline detail::dsv::dsv_manipulator<Geometry> dsv(Geometry const& geometry
             list_open, list_close, list_separator));
 }
 
+/*!
+\brief Writes a geometry as DSV into a buffer of characters
+\details Appends to a growable buffer (such as std::string or
+    std::vector<char>), formatting coordinates directly, without streams.
+    By default coordinates are formatted with the shortest representation
+    which reads back to the same value.
+\ingroup utility
+\param geometry \param_geometry
+\param buffer buffer of characters, to which the DSV is appended
+\param precision number of significant digits of coordinates,
+    or 0 for the shortest representation reading back exactly
+*/
+template <typename Geometry, typename Buffer>
+inline void write_dsv(Geometry const& geometry, Buffer& buffer
+    , int precision = 0
+    , std::string const& coordinate_separator = ", "
+    , std::string const& point_open = "("
+    , std::string const& point_close = ")"
+    , std::string const& point_separator = ", "
+    , std::string const& list_open = "("
+    , std::string const& list_close = ")"
+    , std::string const& list_separator = ", "
+    )
+{
+    concept::check<Geometry const>();
+
+    detail::io::buffer_stream<Buffer> os(buffer, precision);
+    dispatch::dsv
+        <
+            typename tag_cast
+                <
+                    typename tag<Geometry>::type,
+                    multi_tag
+                >::type,
+            Geometry
+        >::apply(os, geometry,
+            detail::dsv::dsv_settings(coordinate_separator,
+                point_open, point_close, point_separator,
+                list_open, list_close, list_separator));
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_DSV_WRITE_HPP
@@ -12,27 +12,37 @@
 #ifndef BOOST_GEOMETRY_IO_SVG_MAPPER_HPP
 #define BOOST_GEOMETRY_IO_SVG_MAPPER_HPP
 
+#include <cstddef>
 #include <cstdio>
-
+#include <ostream>
+#include <string>
 #include <vector>
 
 #include <boost/mpl/assert.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/type_traits/is_base_of.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/utility/enable_if.hpp>
 
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
 
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/tag_cast.hpp>
 
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
 #include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/transform.hpp>
 #include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/unique.hpp>
 #include <boost/geometry/strategies/transform.hpp>
 #include <boost/geometry/strategies/transform/map_transformer.hpp>
 #include <boost/geometry/views/segment_view.hpp>
@@ -40,6 +50,7 @@
 #include <boost/geometry/multi/algorithms/envelope.hpp>
 #include <boost/geometry/multi/algorithms/num_points.hpp>
 
+#include <boost/geometry/io/detail/buffer_stream.hpp>
 #include <boost/geometry/io/svg/write_svg.hpp>
 
 // Helper geometries (all points are transformed to integer-points)
@@ -53,6 +64,67 @@ namespace boost { namespace geometry
 namespace detail { namespace svg
 {
     typedef model::point<int, 2, cs::cartesian> svg_point_type;
+
+    // Ends a line, flushing std::ostream (and derived streams) like before
+    inline void end_line(std::ostream& stream)
+    {
+        stream << std::endl;
+    }
+
+    template <typename OutputStream>
+    inline typename boost::disable_if
+        <
+            boost::is_base_of<std::ostream, OutputStream>
+        >::type end_line(OutputStream& stream)
+    {
+        stream << '\n';
+    }
+
+    // Removes vertices mapped into the same pixel as their predecessor.
+    // Returns false if the range is mapped into one pixel, it is then
+    // not visible and not written.
+    template <typename Range>
+    inline bool decimate(Range& range)
+    {
+        geometry::unique(range);
+        return boost::size(range) > 1;
+    }
+
+    // Decimates all rings of a polygon. Interior rings mapped into one
+    // pixel are removed. Returns false if the exterior ring is mapped
+    // into one pixel.
+    template <typename Polygon>
+    inline bool decimate_polygon(Polygon& polygon)
+    {
+        geometry::unique(polygon);
+        if (boost::size(geometry::exterior_ring(polygon)) <= 1)
+        {
+            return false;
+        }
+
+        typedef typename boost::remove_reference
+            <
+                typename traits::interior_mutable_type<Polygon>::type
+            >::type interior_type;
+
+        typename interior_return_type<Polygon>::type
+            rings = interior_rings(polygon);
+        std::size_t count = 0;
+        for (typename detail::interior_iterator<Polygon>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            if (boost::size(*it) > 1)
+            {
+                if (it != boost::begin(rings) + count)
+                {
+                    *(boost::begin(rings) + count) = *it;
+                }
+                count++;
+            }
+        }
+        traits::resize<interior_type>::apply(rings, count);
+        return true;
+    }
 }}
 #endif
 
@@ -77,29 +149,37 @@ struct svg_map
 template <typename Point>
 struct svg_map<point_tag, Point>
 {
-    template <typename TransformStrategy>
-    static inline void apply(std::ostream& stream,
+    template <typename OutputStream, typename TransformStrategy>
+    static inline void apply(OutputStream& stream,
                     std::string const& style, int size,
-                    Point const& point, TransformStrategy const& strategy)
+                    Point const& point, TransformStrategy const& strategy,
+                    bool = false)
     {
         detail::svg::svg_point_type ipoint;
         geometry::transform(point, ipoint, strategy);
-        stream << geometry::svg(ipoint, style, size) << std::endl;
+        detail::svg::svg_point
+            <
+                detail::svg::svg_point_type
+            >::apply(stream, ipoint, style, size);
+        detail::svg::end_line(stream);
     }
 };
 
 template <typename Box>
 struct svg_map<box_tag, Box>
 {
-    template <typename TransformStrategy>
-    static inline void apply(std::ostream& stream,
+    template <typename OutputStream, typename TransformStrategy>
+    static inline void apply(OutputStream& stream,
                     std::string const& style, int size,
-                    Box const& box, TransformStrategy const& strategy)
+                    Box const& box, TransformStrategy const& strategy,
+                    bool = false)
     {
-        model::box<detail::svg::svg_point_type> ibox;
+        typedef model::box<detail::svg::svg_point_type> box_type;
+        box_type ibox;
         geometry::transform(box, ibox, strategy);
 
-        stream << geometry::svg(ibox, style, size) << std::endl;
+        detail::svg::svg_box<box_type>::apply(stream, ibox, style, size);
+        detail::svg::end_line(stream);
     }
 };
 
@@ -107,24 +187,32 @@ struct svg_map<box_tag, Box>
 template <typename Range1, typename Range2>
 struct svg_map_range
 {
-    template <typename TransformStrategy>
-    static inline void apply(std::ostream& stream,
+    template <typename OutputStream, typename TransformStrategy>
+    static inline void apply(OutputStream& stream,
                 std::string const& style, int size,
-                Range1 const& range, TransformStrategy const& strategy)
+                Range1 const& range, TransformStrategy const& strategy,
+                bool decimate = false)
     {
         Range2 irange;
         geometry::transform(range, irange, strategy);
-        stream << geometry::svg(irange, style, size) << std::endl;
+        if (decimate && ! detail::svg::decimate(irange))
+        {
+            return;
+        }
+        svg<typename tag<Range2>::type, Range2>::apply(stream, irange,
+                    style, size);
+        detail::svg::end_line(stream);
     }
 };
 
 template <typename Segment>
 struct svg_map<segment_tag, Segment>
 {
-    template <typename TransformStrategy>
-    static inline void apply(std::ostream& stream,
+    template <typename OutputStream, typename TransformStrategy>
+    static inline void apply(OutputStream& stream,
                     std::string const& style, int size,
-                    Segment const& segment, TransformStrategy const& strategy)
+                    Segment const& segment, TransformStrategy const& strategy,
+                    bool decimate = false)
     {
         typedef segment_view<Segment> view_type;
         view_type range(segment);
@@ -132,7 +220,7 @@ struct svg_map<segment_tag, Segment>
             <
                 view_type,
                 model::linestring<detail::svg::svg_point_type>
-            >::apply(stream, style, size, range, strategy);
+            >::apply(stream, style, size, range, strategy, decimate);
     }
 };
 
@@ -152,14 +240,21 @@ struct svg_map<linestring_tag, Linestring>
 template <typename Polygon>
 struct svg_map<polygon_tag, Polygon>
 {
-    template <typename TransformStrategy>
-    static inline void apply(std::ostream& stream,
+    template <typename OutputStream, typename TransformStrategy>
+    static inline void apply(OutputStream& stream,
                     std::string const& style, int size,
-                    Polygon const& polygon, TransformStrategy const& strategy)
+                    Polygon const& polygon, TransformStrategy const& strategy,
+                    bool decimate = false)
     {
-        model::polygon<detail::svg::svg_point_type> ipoly;
+        typedef model::polygon<detail::svg::svg_point_type> polygon_type;
+        polygon_type ipoly;
         geometry::transform(polygon, ipoly, strategy);
-        stream << geometry::svg(ipoly, style, size) << std::endl;
+        if (decimate && ! detail::svg::decimate_polygon(ipoly))
+        {
+            return;
+        }
+        detail::svg::svg_poly<polygon_type>::apply(stream, ipoly, style, size);
+        detail::svg::end_line(stream);
     }
 };
 
@@ -172,10 +267,11 @@ struct svg_map<multi_tag, Multi>
           typename geometry::tag<Multi>::type
       >::type stag;
 
-    template <typename TransformStrategy>
-    static inline void apply(std::ostream& stream,
+    template <typename OutputStream, typename TransformStrategy>
+    static inline void apply(OutputStream& stream,
                     std::string const& style, int size,
-                    Multi const& multi, TransformStrategy const& strategy)
+                    Multi const& multi, TransformStrategy const& strategy,
+                    bool decimate = false)
     {
         for (typename boost::range_iterator<Multi const>::type it
             = boost::begin(multi);
@@ -186,7 +282,7 @@ struct svg_map<multi_tag, Multi>
                 <
                     stag,
                     typename boost::range_value<Multi>::type
-                >::apply(stream, style, size, *it, strategy);
+                >::apply(stream, style, size, *it, strategy, decimate);
         }
     }
 };
@@ -196,10 +292,11 @@ struct svg_map<multi_tag, Multi>
 #endif
 
 
-template <typename Geometry, typename TransformStrategy>
-inline void svg_map(std::ostream& stream,
+template <typename OutputStream, typename Geometry, typename TransformStrategy>
+inline void svg_map(OutputStream& stream,
             std::string const& style, int size,
-            Geometry const& geometry, TransformStrategy const& strategy)
+            Geometry const& geometry, TransformStrategy const& strategy,
+            bool decimate = false)
 {
     dispatch::svg_map
         <
@@ -209,12 +306,19 @@ inline void svg_map(std::ostream& stream,
                     multi_tag
                 >::type,
             typename boost::remove_const<Geometry>::type
-        >::apply(stream, style, size, geometry, strategy);
+        >::apply(stream, style, size, geometry, strategy, decimate);
 }
 
 
 /*!
 \brief Helper class to create SVG maps
+\details The extent of the map is either the envelope of all geometries
+    added before mapping, or an extent specified in the constructor.
+    With a specified extent, the mapper streams: geometries outside the
+    extent are skipped, vertices mapped into the same pixel as their
+    predecessor are dropped, and the SVG is written into a buffer which is
+    flushed in large blocks. The size of the SVG then depends on the number
+    of pixels rather than on the number of vertices.
 \tparam Point Point type, for input geometries.
 \tparam SameScale Boolean flag indicating if horizontal and vertical scale should
     be the same. The default value is true
@@ -246,6 +350,21 @@ class svg_mapper : boost::noncopyable
     int m_width, m_height;
     std::string m_width_height; // for <svg> tag only, defaults to 2x 100%
 
+    // Streaming mode, for a specified extent
+    bool m_streaming;
+    std::string m_buffer;
+
+    static const std::size_t buffer_size = 1024 * 1024;
+
+    void flush_buffer()
+    {
+        if (! m_buffer.empty())
+        {
+            m_stream.write(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
     void init_matrix()
     {
         if (! m_matrix)
@@ -286,28 +405,53 @@ public :
         , m_width(width)
         , m_height(height)
         , m_width_height(width_height)
+        , m_streaming(false)
     {
         assign_inverse(m_bounding_box);
     }
 
+    /*!
+    \brief Constructor, initializing the SVG map for a specified extent,
+        in streaming mode. Geometries can be mapped without adding them.
+    \param stream Output stream, should be a stream already open
+    \param width Width of the SVG map (in SVG pixels)
+    \param height Height of the SVG map (in SVG pixels)
+    \param extent Extent of the map (in map units)
+    \param width_height Optional information to increase width and/or height
+    */
+    svg_mapper(std::ostream& stream, int width, int height
+        , model::box<Point> const& extent
+        , std::string const& width_height = "width=\"100%\" height=\"100%\"")
+        : m_bounding_box(extent)
+        , m_stream(stream)
+        , m_width(width)
+        , m_height(height)
+        , m_width_height(width_height)
+        , m_streaming(true)
+    {
+        m_buffer.reserve(buffer_size);
+    }
+
     /*!
     \brief Destructor, called automatically. Closes the SVG by streaming <\/svg>
     */
     virtual ~svg_mapper()
     {
+        flush_buffer();
         m_stream << "</svg>" << std::endl;
     }
 
     /*!
     \brief Adds a geometry to the transformation matrix. After doing this,
         the specified geometry can be mapped fully into the SVG map
+    \note Has no effect in streaming mode, the extent is then specified
     \tparam Geometry \tparam_geometry
     \param geometry \param_geometry
     */
     template <typename Geometry>
     void add(Geometry const& geometry)
     {
-        if (num_points(geometry) > 0)
+        if (! m_streaming && num_points(geometry) > 0)
         {
             expand(m_bounding_box,
                 return_envelope
@@ -330,7 +474,26 @@ public :
                 int size = -1)
     {
         init_matrix();
-        svg_map(m_stream, style, size, geometry, *m_matrix);
+
+        if (! m_streaming)
+        {
+            svg_map(m_stream, style, size, geometry, *m_matrix);
+            return;
+        }
+
+        if (num_points(geometry) == 0
+            || geometry::disjoint(return_envelope<model::box<Point> >(geometry),
+                                  m_bounding_box))
+        {
+            return;
+        }
+
+        detail::io::buffer_stream<std::string> os(m_buffer, 0);
+        svg_map(os, style, size, geometry, *m_matrix, true);
+        if (m_buffer.size() >= buffer_size)
+        {
+            flush_buffer();
+        }
     }
 
     /*!
@@ -349,6 +512,7 @@ public :
                 int offset_x = 0, int offset_y = 0, int lineheight = 10)
     {
         init_matrix();
+        flush_buffer();
         detail::svg::svg_point_type map_point;
         transform(point, map_point, *m_matrix);
         m_stream
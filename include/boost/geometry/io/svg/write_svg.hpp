@@ -41,8 +41,8 @@ namespace detail { namespace svg
 template <typename Point>
 struct svg_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Point const& p, std::string const& style, int size)
     {
         os << "<circle cx=\"" << geometry::get<0>(p)
@@ -56,8 +56,8 @@ struct svg_point
 template <typename Box>
 struct svg_box
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box, std::string const& style, int )
     {
         // Prevent invisible boxes, making them >=1, using "max"
@@ -85,8 +85,8 @@ struct svg_box
 template <typename Range, typename Policy>
 struct svg_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
         Range const& range, std::string const& style, int )
     {
         typedef typename boost::range_iterator<Range const>::type iterator;
@@ -113,8 +113,8 @@ struct svg_range
 template <typename Polygon>
 struct svg_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
         Polygon const& polygon, std::string const& style, int )
     {
         typedef typename geometry::ring_type<Polygon>::type ring_type;
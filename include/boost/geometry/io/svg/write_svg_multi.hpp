@@ -27,8 +27,8 @@ namespace detail { namespace svg
 template <typename MultiGeometry, typename Policy>
 struct svg_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
         MultiGeometry const& multi, std::string const& style, int size)
     {
         for (typename boost::range_iterator<MultiGeometry const>::type
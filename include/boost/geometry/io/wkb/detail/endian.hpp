@@ -0,0 +1,103 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
+
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Bytes are combined by shifting, so conversions do not depend on the
+// byte order of the platform. Doubles are assumed to be IEEE 754, with
+// the same byte order as 64 bit integers.
+
+template <typename UInt, typename Iterator>
+inline bool read_unsigned(Iterator& it, Iterator const& end, bool big_endian,
+            UInt& value)
+{
+    value = 0;
+    for (std::size_t i = 0; i < sizeof(UInt); i++, ++it)
+    {
+        if (it == end)
+        {
+            return false;
+        }
+        UInt const byte = static_cast<unsigned char>(*it);
+        value |= byte << (8 * (big_endian ? sizeof(UInt) - 1 - i : i));
+    }
+    return true;
+}
+
+template <typename Iterator>
+inline bool read_uint32(Iterator& it, Iterator const& end, bool big_endian,
+            boost::uint32_t& value)
+{
+    return read_unsigned(it, end, big_endian, value);
+}
+
+template <typename Iterator>
+inline bool read_double(Iterator& it, Iterator const& end, bool big_endian,
+            double& value)
+{
+    BOOST_STATIC_ASSERT(sizeof(double) == sizeof(boost::uint64_t));
+
+    boost::uint64_t bits;
+    if (! read_unsigned(it, end, big_endian, bits))
+    {
+        return false;
+    }
+    std::memcpy(&value, &bits, sizeof(double));
+    return true;
+}
+
+template <typename UInt, typename OutputIterator>
+inline void write_unsigned(UInt value, bool big_endian, OutputIterator& out)
+{
+    for (std::size_t i = 0; i < sizeof(UInt); i++)
+    {
+        *out++ = static_cast<unsigned char>(
+            (value >> (8 * (big_endian ? sizeof(UInt) - 1 - i : i))) & 0xFF);
+    }
+}
+
+template <typename OutputIterator>
+inline void write_uint32(boost::uint32_t value, bool big_endian,
+            OutputIterator& out)
+{
+    write_unsigned(value, big_endian, out);
+}
+
+template <typename OutputIterator>
+inline void write_double(double value, bool big_endian, OutputIterator& out)
+{
+    BOOST_STATIC_ASSERT(sizeof(double) == sizeof(boost::uint64_t));
+
+    boost::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+    write_unsigned(bits, big_endian, out);
+}
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_ENDIAN_HPP
@@ -0,0 +1,70 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
+
+#include <boost/cstdint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// The byte order marker, the first byte of each WKB geometry
+struct byte_order_type
+{
+    enum enum_t
+    {
+        xdr = 0, // big endian
+        ndr = 1  // little endian
+    };
+};
+
+// The geometry type, as defined by OGC Simple Features
+struct geometry_type
+{
+    enum enum_t
+    {
+        point = 1,
+        linestring = 2,
+        polygon = 3,
+        multipoint = 4,
+        multilinestring = 5,
+        multipolygon = 6,
+        geometrycollection = 7
+    };
+};
+
+// Offsets and flags, added to the geometry type, indicating that
+// coordinates have Z and/or M values. ISO uses offsets, EWKB (PostGIS)
+// uses flags, EWKB can also contain an SRID
+struct geometry_type_modifier
+{
+    static const boost::uint32_t iso_z = 1000;
+    static const boost::uint32_t iso_m = 2000;
+    static const boost::uint32_t iso_zm = 3000;
+
+    static const boost::uint32_t ewkb_z = 0x80000000;
+    static const boost::uint32_t ewkb_m = 0x40000000;
+    static const boost::uint32_t ewkb_srid = 0x20000000;
+    static const boost::uint32_t ewkb_flags = 0xF0000000;
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_OGC_HPP
@@ -0,0 +1,574 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
+#define BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/range.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// The header of each (sub)geometry: byte order, type, and number of
+// values per point
+struct header
+{
+    bool big_endian;
+    boost::uint32_t type;
+    bool has_z;
+    std::size_t value_count;
+
+    template <typename Iterator>
+    inline bool read(Iterator& it, Iterator const& end)
+    {
+        typedef geometry_type_modifier modifier;
+
+        if (it == end)
+        {
+            return false;
+        }
+        unsigned char const order = static_cast<unsigned char>(*it++);
+        if (order != byte_order_type::xdr && order != byte_order_type::ndr)
+        {
+            return false;
+        }
+        big_endian = order == byte_order_type::xdr;
+
+        if (! read_uint32(it, end, big_endian, type))
+        {
+            return false;
+        }
+
+        has_z = (type & modifier::ewkb_z) != 0;
+        bool has_m = (type & modifier::ewkb_m) != 0;
+        bool const has_srid = (type & modifier::ewkb_srid) != 0;
+        type &= ~modifier::ewkb_flags;
+
+        if (type > modifier::iso_zm)
+        {
+            has_z = has_m = true;
+            type -= modifier::iso_zm;
+        }
+        else if (type > modifier::iso_m)
+        {
+            has_m = true;
+            type -= modifier::iso_m;
+        }
+        else if (type > modifier::iso_z)
+        {
+            has_z = true;
+            type -= modifier::iso_z;
+        }
+
+        value_count = 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
+
+        // The SRID is skipped
+        boost::uint32_t srid;
+        return ! has_srid || read_uint32(it, end, big_endian, srid);
+    }
+};
+
+
+template <typename Point, std::size_t Dimension, std::size_t DimensionCount>
+struct coordinates_parser
+{
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                header const& h, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        // Missing values are set to zero, like in WKT
+        double value = 0;
+        if (Dimension < h.value_count
+            && ! read_double(it, end, h.big_endian, value))
+        {
+            return false;
+        }
+        set<Dimension>(point, static_cast<coordinate_type>(value));
+
+        return coordinates_parser
+            <
+                Point, Dimension + 1, DimensionCount
+            >::apply(it, end, h, point);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct coordinates_parser<Point, DimensionCount, DimensionCount>
+{
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                header const& h, Point& )
+    {
+        // Skip values not fitting in the point (M)
+        double value;
+        for (std::size_t i = DimensionCount; i < h.value_count; i++)
+        {
+            if (! read_double(it, end, h.big_endian, value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
+// Parsers for the contents, following the header
+
+template <typename Point>
+struct point_parser
+{
+    static const boost::uint32_t type = geometry_type::point;
+
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                header const& h, Point& point)
+    {
+        return coordinates_parser
+            <
+                Point, 0, dimension<Point>::value
+            >::apply(it, end, h, point);
+    }
+};
+
+// Range is a value-type or reference-type. If Open is true, the closing
+// point, which OGC rings always have, is not added
+template <typename Range, bool Open = false>
+struct point_container_parser
+{
+    typedef typename boost::remove_reference<Range>::type range_type;
+    typedef typename point_type<range_type>::type point_type;
+
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                header const& h, Range range)
+    {
+        boost::uint32_t count;
+        if (! read_uint32(it, end, h.big_endian, count))
+        {
+            return false;
+        }
+
+        if (count == 0)
+        {
+            return true;
+        }
+
+        point_type first;
+        if (! point_parser<point_type>::apply(it, end, h, first))
+        {
+            return false;
+        }
+        traits::push_back<range_type>::apply(range, first);
+
+        point_type point;
+        for (boost::uint32_t i = 1; i < count; i++)
+        {
+            if (! point_parser<point_type>::apply(it, end, h, point))
+            {
+                return false;
+            }
+            if (Open && i == count - 1
+                && geometry::detail::equals::equals_point_point(point, first))
+            {
+                break;
+            }
+            traits::push_back<range_type>::apply(range, point);
+        }
+        return true;
+    }
+};
+
+// Ring is a value-type or reference-type
+template <typename Ring>
+struct ring_points_parser
+    : point_container_parser
+        <
+            Ring,
+            geometry::closure
+                <
+                    typename boost::remove_reference<Ring>::type
+                >::value == open
+        >
+{};
+
+template <typename Linestring>
+struct linestring_parser
+{
+    static const boost::uint32_t type = geometry_type::linestring;
+
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                header const& h, Linestring& linestring)
+    {
+        return point_container_parser<Linestring&>::apply(it, end, h, linestring);
+    }
+};
+
+// A ring is read from a polygon without interior rings
+template <typename Ring>
+struct ring_parser
+{
+    static const boost::uint32_t type = geometry_type::polygon;
+
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                header const& h, Ring& ring)
+    {
+        boost::uint32_t count;
+        if (! read_uint32(it, end, h.big_endian, count) || count > 1)
+        {
+            return false;
+        }
+        return count == 0
+            || ring_points_parser<Ring&>::apply(it, end, h, ring);
+    }
+};
+
+template <typename Polygon>
+struct polygon_parser
+{
+    static const boost::uint32_t type = geometry_type::polygon;
+
+    typedef typename ring_return_type<Polygon>::type ring_return_type;
+    typedef typename boost::remove_reference
+        <
+            typename traits::interior_mutable_type<Polygon>::type
+        >::type interior_type;
+
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                header const& h, Polygon& polygon)
+    {
+        boost::uint32_t count;
+        if (! read_uint32(it, end, h.big_endian, count))
+        {
+            return false;
+        }
+        if (count == 0)
+        {
+            return true;
+        }
+
+        if (! ring_points_parser<ring_return_type>::apply(it, end, h,
+                    exterior_ring(polygon)))
+        {
+            return false;
+        }
+
+        typename interior_return_type<Polygon>::type interiors
+                    = interior_rings(polygon);
+        for (boost::uint32_t i = 1; i < count; i++)
+        {
+            // Added one by one, such that an invalid count cannot
+            // allocate much
+            traits::resize<interior_type>::apply(interiors, i);
+            if (! ring_points_parser
+                    <
+                        typename ring_type<Polygon>::type&
+                    >::apply(it, end, h, *(boost::end(interiors) - 1)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Reads a header, verifying the type, and the contents
+template <typename Geometry, typename Parser>
+struct geometry_parser
+{
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                Geometry& geometry)
+    {
+        header h;
+        if (! h.read(it, end)
+            || h.type != Parser::type
+            || (h.has_z && dimension<Geometry>::value < 3))
+        {
+            return false;
+        }
+        geometry::clear(geometry);
+        return Parser::apply(it, end, h, geometry);
+    }
+};
+
+template <typename MultiGeometry, typename Parser, boost::uint32_t Type>
+struct multi_parser
+{
+    typedef typename boost::range_value<MultiGeometry>::type member_type;
+
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end,
+                MultiGeometry& multi)
+    {
+        header h;
+        if (! h.read(it, end) || h.type != Type)
+        {
+            return false;
+        }
+
+        boost::uint32_t count;
+        if (! read_uint32(it, end, h.big_endian, count))
+        {
+            return false;
+        }
+
+        // Each member has its own header (with possibly another byte order)
+        traits::clear<MultiGeometry>::apply(multi);
+        for (boost::uint32_t i = 0; i < count; i++)
+        {
+            traits::resize<MultiGeometry>::apply(multi, i + 1);
+            if (! geometry_parser<member_type, Parser>::apply(it, end,
+                        *(boost::end(multi) - 1)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
+// Box (non-OGC): read from a polygon, taking the corners like WKT does
+template <typename Box>
+struct box_parser
+{
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end, Box& box)
+    {
+        typedef typename point_type<Box>::type point_type;
+        typedef model::ring<point_type> ring_type;
+
+        ring_type points;
+        if (! geometry_parser<ring_type, ring_parser<ring_type> >::apply(it, end, points))
+        {
+            return false;
+        }
+
+        std::size_t const n = points.size();
+        if (n != 2 && n != 4 && n != 5)
+        {
+            return false;
+        }
+
+        geometry::detail::assign_point_to_index<min_corner>(points.front(), box);
+        geometry::detail::assign_point_to_index<max_corner>(points[n == 2 ? 1 : 2], box);
+        return true;
+    }
+};
+
+// Segment (non-OGC): read from a linestring of two points
+template <typename Segment>
+struct segment_parser
+{
+    template <typename Iterator>
+    static inline bool apply(Iterator& it, Iterator const& end, Segment& segment)
+    {
+        typedef typename point_type<Segment>::type point_type;
+        typedef model::linestring<point_type> linestring_type;
+
+        linestring_type points;
+        if (! geometry_parser
+                <
+                    linestring_type, linestring_parser<linestring_type>
+                >::apply(it, end, points)
+            || points.size() != 2)
+        {
+            return false;
+        }
+
+        geometry::detail::assign_point_to_index<0>(points.front(), segment);
+        geometry::detail::assign_point_to_index<1>(points.back(), segment);
+        return true;
+    }
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_wkb : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct read_wkb<Point, point_tag>
+    : detail::wkb::geometry_parser<Point, detail::wkb::point_parser<Point> >
+{};
+
+template <typename Linestring>
+struct read_wkb<Linestring, linestring_tag>
+    : detail::wkb::geometry_parser
+        <
+            Linestring, detail::wkb::linestring_parser<Linestring>
+        >
+{};
+
+template <typename Ring>
+struct read_wkb<Ring, ring_tag>
+    : detail::wkb::geometry_parser<Ring, detail::wkb::ring_parser<Ring> >
+{};
+
+template <typename Polygon>
+struct read_wkb<Polygon, polygon_tag>
+    : detail::wkb::geometry_parser
+        <
+            Polygon, detail::wkb::polygon_parser<Polygon>
+        >
+{};
+
+template <typename MultiPoint>
+struct read_wkb<MultiPoint, multi_point_tag>
+    : detail::wkb::multi_parser
+        <
+            MultiPoint,
+            detail::wkb::point_parser
+                <
+                    typename boost::range_value<MultiPoint>::type
+                >,
+            detail::wkb::geometry_type::multipoint
+        >
+{};
+
+template <typename MultiLinestring>
+struct read_wkb<MultiLinestring, multi_linestring_tag>
+    : detail::wkb::multi_parser
+        <
+            MultiLinestring,
+            detail::wkb::linestring_parser
+                <
+                    typename boost::range_value<MultiLinestring>::type
+                >,
+            detail::wkb::geometry_type::multilinestring
+        >
+{};
+
+template <typename MultiPolygon>
+struct read_wkb<MultiPolygon, multi_polygon_tag>
+    : detail::wkb::multi_parser
+        <
+            MultiPolygon,
+            detail::wkb::polygon_parser
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >,
+            detail::wkb::geometry_type::multipolygon
+        >
+{};
+
+template <typename Box>
+struct read_wkb<Box, box_tag>
+    : detail::wkb::box_parser<Box>
+{};
+
+template <typename Segment>
+struct read_wkb<Segment, segment_tag>
+    : detail::wkb::segment_parser<Segment>
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Parses OGC Well-Known Binary (WKB) into a geometry (any geometry)
+\details Reads both byte orders (also mixed within multi-geometries),
+    and ISO and PostGIS (EWKB) type codes for Z and M values. M values are
+    skipped, an SRID is skipped. Coordinates are read directly into the
+    geometry, without intermediate copies.
+\ingroup wkb
+\tparam Iterator iterator over bytes (char or unsigned char)
+\tparam Geometry \tparam_geometry
+\param begin iterator to the first byte of the WKB
+\param end iterator past the last byte of the WKB
+\param geometry \param_geometry output geometry
+\return true if the WKB is read successfully, false if it is invalid,
+    incomplete, followed by other bytes, or of another geometry type
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
+{
+    concept::check<Geometry>();
+    return dispatch::read_wkb<Geometry>::apply(begin, end, geometry)
+        && begin == end;
+}
+
+/*!
+\brief Parses OGC Well-Known Binary (WKB) at the start of a range of bytes
+    into a geometry (any geometry)
+\details As read_wkb, but the WKB may be followed by other bytes, for
+    example by the WKB of another geometry.
+\ingroup wkb
+\tparam Iterator iterator over bytes (char or unsigned char)
+\tparam Geometry \tparam_geometry
+\param begin iterator to the first byte of the WKB
+\param end iterator past the last available byte
+\param geometry \param_geometry output geometry
+\param consumed set to the number of bytes of the WKB of the geometry
+\return true if the WKB is read successfully, false if it is invalid,
+    incomplete, or of another geometry type
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry,
+            std::size_t& consumed)
+{
+    concept::check<Geometry>();
+    Iterator it = begin;
+    bool const result = dispatch::read_wkb<Geometry>::apply(it, end, geometry);
+    consumed = static_cast<std::size_t>(std::distance(begin, it));
+    return result;
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
@@ -0,0 +1,98 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
+#define BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
+
+#include <string>
+
+#include <boost/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+inline int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Converts hex-encoded WKB (as returned by e.g. PostGIS) to bytes
+\ingroup wkb
+\param hex string with two hexadecimal characters per byte
+\param out output iterator receiving bytes
+\return false if the string has an odd length or invalid characters
+*/
+template <typename OutputIterator>
+inline bool hex2wkb(std::string const& hex, OutputIterator out)
+{
+    if (hex.size() % 2 != 0)
+    {
+        return false;
+    }
+
+    for (std::string::size_type i = 0; i < hex.size(); i += 2)
+    {
+        int const high = detail::wkb::hex_value(hex[i]);
+        int const low = detail::wkb::hex_value(hex[i + 1]);
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        *out++ = static_cast<unsigned char>(high * 16 + low);
+    }
+    return true;
+}
+
+/*!
+\brief Converts WKB bytes to an uppercase hex-encoded string
+\ingroup wkb
+\param bytes range of bytes (char or unsigned char)
+\param hex output string, to which the hex-encoding is appended
+*/
+template <typename Range>
+inline void wkb2hex(Range const& bytes, std::string& hex)
+{
+    static char const digits[] = "0123456789ABCDEF";
+
+    hex.reserve(hex.size() + 2 * boost::size(bytes));
+    for (typename boost::range_iterator<Range const>::type
+            it = boost::begin(bytes); it != boost::end(bytes); ++it)
+    {
+        unsigned char const byte = static_cast<unsigned char>(*it);
+        hex += digits[byte >> 4];
+        hex += digits[byte & 0x0F];
+    }
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_UTILITY_HPP
@@ -0,0 +1,387 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WRITE_WKB_HPP
+#define BOOST_GEOMETRY_IO_WKB_WRITE_WKB_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/range.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/io/wkb/detail/endian.hpp>
+#include <boost/geometry/io/wkb/detail/ogc.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Byte order of written Well-Known Binary (WKB)
+\ingroup wkb
+*/
+enum wkb_byte_order
+{
+    wkb_big_endian = detail::wkb::byte_order_type::xdr,
+    wkb_little_endian = detail::wkb::byte_order_type::ndr
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Points of three or more dimensions are written with Z values
+template <typename Geometry>
+struct written_dimension
+{
+    static const std::size_t value
+        = dimension<Geometry>::value >= 3 ? 3 : 2;
+};
+
+template <typename Geometry, typename OutputIterator>
+inline void write_header(boost::uint32_t type, bool big_endian,
+            OutputIterator& out)
+{
+    *out++ = static_cast<unsigned char>(big_endian
+                ? byte_order_type::xdr : byte_order_type::ndr);
+    write_uint32(written_dimension<Geometry>::value == 3
+                ? type + geometry_type_modifier::iso_z : type,
+            big_endian, out);
+}
+
+template <typename Point, std::size_t Dimension, std::size_t DimensionCount>
+struct coordinates_writer
+{
+    template <typename OutputIterator>
+    static inline void apply(Point const& point, bool big_endian,
+                OutputIterator& out)
+    {
+        write_double(static_cast<double>(get<Dimension>(point)),
+                big_endian, out);
+        coordinates_writer
+            <
+                Point, Dimension + 1, DimensionCount
+            >::apply(point, big_endian, out);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct coordinates_writer<Point, DimensionCount, DimensionCount>
+{
+    template <typename OutputIterator>
+    static inline void apply(Point const&, bool, OutputIterator&)
+    {}
+};
+
+
+template <typename Point>
+struct point_writer
+{
+    template <typename OutputIterator>
+    static inline void apply(Point const& point, bool big_endian,
+                OutputIterator& out)
+    {
+        write_header<Point>(geometry_type::point, big_endian, out);
+        coordinates_writer
+            <
+                Point, 0, written_dimension<Point>::value
+            >::apply(point, big_endian, out);
+    }
+};
+
+// Writes the number of points and their coordinates. If Close is true,
+// the first point is repeated at the end if the range is not closed yet,
+// because OGC rings are closed (as wkt_poly does for WKT)
+template <typename Range, bool Close = false>
+struct points_writer
+{
+    typedef typename point_type<Range>::type point_type;
+
+    template <typename OutputIterator>
+    static inline void apply(Range const& range, bool big_endian,
+                OutputIterator& out)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+        typedef coordinates_writer
+            <
+                point_type, 0, written_dimension<point_type>::value
+            > writer;
+
+        iterator const begin = boost::begin(range);
+        iterator const end = boost::end(range);
+        std::size_t const size = boost::size(range);
+        bool const close = Close
+            && size > 1
+            && ! geometry::detail::equals::equals_point_point(*begin, *(end - 1));
+
+        write_uint32(static_cast<boost::uint32_t>(size + (close ? 1 : 0)),
+                big_endian, out);
+        for (iterator it = begin; it != end; ++it)
+        {
+            writer::apply(*it, big_endian, out);
+        }
+        if (close)
+        {
+            writer::apply(*begin, big_endian, out);
+        }
+    }
+};
+
+// Writes the points of a ring, closed
+template <typename Ring>
+struct ring_points_writer
+    : points_writer
+        <
+            Ring,
+            geometry::closure<Ring>::value == open
+        >
+{};
+
+template <typename Linestring>
+struct linestring_writer
+{
+    template <typename OutputIterator>
+    static inline void apply(Linestring const& linestring, bool big_endian,
+                OutputIterator& out)
+    {
+        write_header<Linestring>(geometry_type::linestring, big_endian, out);
+        points_writer<Linestring>::apply(linestring, big_endian, out);
+    }
+};
+
+// A ring is written as a polygon without interior rings
+template <typename Ring>
+struct ring_writer
+{
+    template <typename OutputIterator>
+    static inline void apply(Ring const& ring, bool big_endian,
+                OutputIterator& out)
+    {
+        write_header<Ring>(geometry_type::polygon, big_endian, out);
+        write_uint32(1, big_endian, out);
+        ring_points_writer<Ring>::apply(ring, big_endian, out);
+    }
+};
+
+template <typename Polygon>
+struct polygon_writer
+{
+    typedef typename ring_type<Polygon>::type ring_type;
+
+    template <typename OutputIterator>
+    static inline void apply(Polygon const& polygon, bool big_endian,
+                OutputIterator& out)
+    {
+        typename interior_return_type<Polygon const>::type
+            interiors = interior_rings(polygon);
+
+        write_header<Polygon>(geometry_type::polygon, big_endian, out);
+        write_uint32(static_cast<boost::uint32_t>(1 + boost::size(interiors)),
+                big_endian, out);
+        ring_points_writer<ring_type>::apply(exterior_ring(polygon), big_endian, out);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(interiors); it != boost::end(interiors); ++it)
+        {
+            ring_points_writer<ring_type>::apply(*it, big_endian, out);
+        }
+    }
+};
+
+template <typename MultiGeometry, typename Writer, boost::uint32_t Type>
+struct multi_writer
+{
+    template <typename OutputIterator>
+    static inline void apply(MultiGeometry const& multi, bool big_endian,
+                OutputIterator& out)
+    {
+        write_header<MultiGeometry>(Type, big_endian, out);
+        write_uint32(static_cast<boost::uint32_t>(boost::size(multi)),
+                big_endian, out);
+        for (typename boost::range_iterator<MultiGeometry const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            Writer::apply(*it, big_endian, out);
+        }
+    }
+};
+
+// Box (non-OGC): written as a polygon, like WKT does
+template <typename Box>
+struct box_writer
+{
+    typedef typename point_type<Box>::type point_type;
+    typedef model::ring<point_type> ring_type;
+
+    template <typename OutputIterator>
+    static inline void apply(Box const& box, bool big_endian,
+                OutputIterator& out)
+    {
+        ring_type ring;
+        geometry::convert(box, ring);
+        ring_writer<ring_type>::apply(ring, big_endian, out);
+    }
+};
+
+// Segment (non-OGC): written as a linestring of two points
+template <typename Segment>
+struct segment_writer
+{
+    typedef typename point_type<Segment>::type point_type;
+
+    template <typename OutputIterator>
+    static inline void apply(Segment const& segment, bool big_endian,
+                OutputIterator& out)
+    {
+        point_type points[2];
+        geometry::detail::assign_point_from_index<0>(segment, points[0]);
+        geometry::detail::assign_point_from_index<1>(segment, points[1]);
+
+        write_header<Segment>(geometry_type::linestring, big_endian, out);
+        write_uint32(2, big_endian, out);
+        for (int i = 0; i < 2; i++)
+        {
+            coordinates_writer
+                <
+                    point_type, 0, written_dimension<point_type>::value
+                >::apply(points[i], big_endian, out);
+        }
+    }
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct write_wkb : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct write_wkb<Point, point_tag>
+    : detail::wkb::point_writer<Point>
+{};
+
+template <typename Linestring>
+struct write_wkb<Linestring, linestring_tag>
+    : detail::wkb::linestring_writer<Linestring>
+{};
+
+template <typename Ring>
+struct write_wkb<Ring, ring_tag>
+    : detail::wkb::ring_writer<Ring>
+{};
+
+template <typename Polygon>
+struct write_wkb<Polygon, polygon_tag>
+    : detail::wkb::polygon_writer<Polygon>
+{};
+
+template <typename MultiPoint>
+struct write_wkb<MultiPoint, multi_point_tag>
+    : detail::wkb::multi_writer
+        <
+            MultiPoint,
+            detail::wkb::point_writer
+                <
+                    typename boost::range_value<MultiPoint>::type
+                >,
+            detail::wkb::geometry_type::multipoint
+        >
+{};
+
+template <typename MultiLinestring>
+struct write_wkb<MultiLinestring, multi_linestring_tag>
+    : detail::wkb::multi_writer
+        <
+            MultiLinestring,
+            detail::wkb::linestring_writer
+                <
+                    typename boost::range_value<MultiLinestring>::type
+                >,
+            detail::wkb::geometry_type::multilinestring
+        >
+{};
+
+template <typename MultiPolygon>
+struct write_wkb<MultiPolygon, multi_polygon_tag>
+    : detail::wkb::multi_writer
+        <
+            MultiPolygon,
+            detail::wkb::polygon_writer
+                <
+                    typename boost::range_value<MultiPolygon>::type
+                >,
+            detail::wkb::geometry_type::multipolygon
+        >
+{};
+
+template <typename Box>
+struct write_wkb<Box, box_tag>
+    : detail::wkb::box_writer<Box>
+{};
+
+template <typename Segment>
+struct write_wkb<Segment, segment_tag>
+    : detail::wkb::segment_writer<Segment>
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes a geometry (any geometry) as OGC Well-Known Binary (WKB)
+\details Geometries with three or more dimensions are written with
+    Z values (ISO type codes). Boxes are written as polygons, segments
+    as linestrings.
+\ingroup wkb
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator output iterator receiving bytes
+\param geometry \param_geometry
+\param out output iterator
+\param byte_order byte order of the written WKB
+\return output iterator, positioned after the written bytes
+*/
+template <typename Geometry, typename OutputIterator>
+inline OutputIterator write_wkb(Geometry const& geometry, OutputIterator out,
+            wkb_byte_order byte_order = wkb_little_endian)
+{
+    concept::check<Geometry const>();
+    dispatch::write_wkb<Geometry>::apply(geometry,
+            byte_order == wkb_big_endian, out);
+    return out;
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WRITE_WKB_HPP
@@ -0,0 +1,254 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_PARSE_NUMBER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_PARSE_NUMBER_HPP
+
+#include <limits>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_signed.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Powers of ten which are exactly representable in a double
+inline double power_of_ten(int n)
+{
+    static double const powers[] =
+        {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+    return powers[n];
+}
+
+
+/*!
+\brief Internal, converts the characters of a number to a coordinate value
+\details Returns false if the number cannot be converted fast and exactly,
+    the caller then falls back to coordinate_cast (which also reports
+    invalid numbers). Coordinate types other than fundamental types
+    always fall back.
+*/
+template
+<
+    typename T,
+    bool IsFloatingPoint = boost::is_floating_point<T>::value,
+    bool IsIntegral = boost::is_integral<T>::value
+>
+struct parse_number
+{
+    static inline bool apply(char const*, char const*, T& )
+    {
+        return false;
+    }
+};
+
+
+// Floating point: uses the exact case of Clinger's algorithm. A mantissa
+// and a power of ten which are both exactly representable are multiplied
+// or divided once, which is correctly rounded by IEEE arithmetic.
+// All other cases (too many digits, large exponents) fall back.
+template <typename T>
+struct parse_number<T, true, false>
+{
+    static const int digits = std::numeric_limits<T>::digits;
+
+    // Largest power of ten of which the value is exactly representable
+    // (5^22 fits in 53 bits, 5^10 in 24 bits)
+    static const int max_exponent = digits >= 53 ? 22 : 10;
+
+    static inline bool apply(char const* it, char const* end, T& value)
+    {
+        if (digits < 24)
+        {
+            return false;
+        }
+
+        bool negative = false;
+        if (it != end && (*it == '-' || *it == '+'))
+        {
+            negative = *it == '-';
+            ++it;
+        }
+
+        boost::uint64_t mantissa = 0;
+        int significant = 0;
+        int exponent = 0;
+        bool has_digits = false;
+        bool in_fraction = false;
+
+        for ( ; it != end; ++it)
+        {
+            if (*it == '.' && ! in_fraction)
+            {
+                in_fraction = true;
+                continue;
+            }
+            if (! is_digit(*it))
+            {
+                break;
+            }
+
+            has_digits = true;
+            int const d = *it - '0';
+            if (mantissa > 0 || d > 0)
+            {
+                if (++significant > 19)
+                {
+                    return false;
+                }
+                mantissa = mantissa * 10 + d;
+            }
+            if (in_fraction)
+            {
+                exponent--;
+            }
+        }
+
+        if (! has_digits)
+        {
+            return false;
+        }
+
+        if (it != end && (*it == 'e' || *it == 'E'))
+        {
+            ++it;
+            bool negative_exponent = false;
+            if (it != end && (*it == '-' || *it == '+'))
+            {
+                negative_exponent = *it == '-';
+                ++it;
+            }
+            if (it == end || ! is_digit(*it))
+            {
+                return false;
+            }
+            int e = 0;
+            for ( ; it != end && is_digit(*it); ++it)
+            {
+                if (e > 10000)
+                {
+                    return false;
+                }
+                e = e * 10 + (*it - '0');
+            }
+            exponent += negative_exponent ? -e : e;
+        }
+
+        if (it != end)
+        {
+            return false;
+        }
+
+        if (digits < 64 && mantissa > (boost::uint64_t(1) << digits))
+        {
+            return false;
+        }
+
+        T result = T();
+        if (mantissa > 0)
+        {
+            if (exponent < -max_exponent || exponent > max_exponent)
+            {
+                return false;
+            }
+
+            result = static_cast<T>(mantissa);
+            T const power = static_cast<T>(power_of_ten(exponent < 0 ? -exponent : exponent));
+            result = exponent < 0 ? result / power : result * power;
+        }
+
+        value = negative ? -result : result;
+        return true;
+    }
+};
+
+
+// Integral: only digits, with an optional sign, which do not overflow
+template <typename T>
+struct parse_number<T, false, true>
+{
+    static inline bool apply(char const* it, char const* end, T& value)
+    {
+        bool negative = false;
+        if (it != end && (*it == '-' || *it == '+'))
+        {
+            negative = *it == '-';
+            ++it;
+        }
+
+        if (it == end || (negative && ! boost::is_signed<T>::value))
+        {
+            return false;
+        }
+
+        // Accumulated negatively, such that the minimum value fits
+        T const limit = (std::numeric_limits<T>::min)();
+        T result = 0;
+        for ( ; it != end; ++it)
+        {
+            if (! is_digit(*it))
+            {
+                return false;
+            }
+            T const d = static_cast<T>(*it - '0');
+            if (boost::is_signed<T>::value)
+            {
+                if (result < (limit + d) / 10)
+                {
+                    return false;
+                }
+                result = result * 10 - d;
+            }
+            else
+            {
+                if (result > ((std::numeric_limits<T>::max)() - d) / 10)
+                {
+                    return false;
+                }
+                result = result * 10 + d;
+            }
+        }
+
+        if (boost::is_signed<T>::value && ! negative)
+        {
+            if (result < -(std::numeric_limits<T>::max)())
+            {
+                return false;
+            }
+            result = -result;
+        }
+
+        value = result;
+        return true;
+    }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_PARSE_NUMBER_HPP
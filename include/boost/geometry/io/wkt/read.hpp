@@ -44,11 +44,46 @@
 
 #include <boost/geometry/util/coordinate_cast.hpp>
 
+#include <boost/geometry/io/wkt/detail/parse_number.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
 
 namespace boost { namespace geometry
 {
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+// Characters separating tokens, which are not tokens themselves
+inline bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Characters separating tokens, which are tokens themselves
+inline bool is_separator(char c)
+{
+    return c == ',' || c == '(' || c == ')';
+}
+
+// Returns the end of the token starting at it
+inline char const* token_end(char const* it, char const* end)
+{
+    if (it != end && is_separator(*it))
+    {
+        return it + 1;
+    }
+    while (it != end && ! is_space(*it) && ! is_separator(*it))
+    {
+        ++it;
+    }
+    return it;
+}
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
 /*!
 \brief Exception showing things wrong with WKT parsing
 \ingroup wkt
@@ -70,6 +105,20 @@ struct read_wkt_exception : public geometry::exception
         complete = message + source + " in '" + wkt.substr(0, 100) + "'";
     }
 
+    read_wkt_exception(std::string const& msg,
+            char const* it, char const* end, std::string const& wkt)
+        : message(msg)
+        , wkt(wkt)
+    {
+        if (it != end)
+        {
+            source = " at '";
+            source.append(it, detail::wkt::token_end(it, end));
+            source += "'";
+        }
+        complete = message + source + " in '" + wkt.substr(0, 100) + "'";
+    }
+
     read_wkt_exception(std::string const& msg, std::string const& wkt)
         : message(msg)
         , wkt(wkt)
@@ -98,6 +147,146 @@ namespace detail { namespace wkt
 
 typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
 
+
+/*!
+\brief Internal, scans WKT in a range of characters
+\details Recognizes the same tokens as the tokenizer (separated by spaces,
+    and by ",", "(" and ")" which are tokens themselves), without copying
+    them into strings. Tabs and newlines are handled as spaces.
+*/
+class scanner
+{
+public :
+    inline scanner(char const* first, char const* last)
+        : m_first(first)
+        , m_it(first)
+        , m_end(last)
+    {}
+
+    // Returns true if all tokens are scanned
+    inline bool at_end()
+    {
+        skip_spaces();
+        return m_it == m_end;
+    }
+
+    // Returns true if the next token is the specified separator
+    inline bool is(char separator)
+    {
+        skip_spaces();
+        return m_it != m_end && *m_it == separator;
+    }
+
+    // Skips the next token if it is the specified separator
+    inline bool accept(char separator)
+    {
+        if (is(separator))
+        {
+            ++m_it;
+            return true;
+        }
+        return false;
+    }
+
+    // Skips the next token if it equals the word (case insensitive)
+    inline bool accept_word(char const* word)
+    {
+        skip_spaces();
+        char const* it = m_it;
+        for ( ; *word != '\0'; ++word, ++it)
+        {
+            if (it == m_end || upper(*it) != upper(*word))
+            {
+                return false;
+            }
+        }
+        if (it != token_end(m_it, m_end))
+        {
+            return false;
+        }
+        m_it = it;
+        return true;
+    }
+
+    inline void open_parenthesis()
+    {
+        if (! accept('('))
+        {
+            throw read_wkt_exception("Expected '('", m_it, m_end, wkt());
+        }
+    }
+
+    inline void close_parenthesis()
+    {
+        if (! accept(')'))
+        {
+            throw read_wkt_exception("Expected ')'", m_it, m_end, wkt());
+        }
+    }
+
+    inline void check_end()
+    {
+        if (! at_end())
+        {
+            throw read_wkt_exception("Too much tokens", m_it, m_end, wkt());
+        }
+    }
+
+    // Converts the next token to a coordinate value
+    template <typename T>
+    inline void read(T& value)
+    {
+        skip_spaces();
+        char const* end = token_end(m_it, m_end);
+        if (! parse_number<T>::apply(m_it, end, value))
+        {
+            try
+            {
+                value = coordinate_cast<T>::apply(std::string(m_it, end));
+            }
+            catch(boost::bad_lexical_cast const& blc)
+            {
+                throw read_wkt_exception(blc.what(), m_it, m_end, wkt());
+            }
+            catch(std::exception const& e)
+            {
+                throw read_wkt_exception(e.what(), m_it, m_end, wkt());
+            }
+            catch(...)
+            {
+                throw read_wkt_exception("", m_it, m_end, wkt());
+            }
+        }
+        m_it = end;
+    }
+
+    // Returns the start of the scanned WKT, as reported in exceptions
+    inline std::string wkt() const
+    {
+        return std::string(m_first,
+            m_end - m_first > 100 ? m_first + 100 : m_end);
+    }
+
+private :
+    static inline char upper(char c)
+    {
+        return c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c;
+    }
+
+    inline void skip_spaces()
+    {
+        while (m_it != m_end && is_space(*m_it))
+        {
+            ++m_it;
+        }
+    }
+
+    char const* m_first;
+    char const* m_it;
+    char const* m_end;
+};
+
+
 template <typename Point, std::size_t Dimension, std::size_t DimensionCount>
 struct parsing_assigner
 {
@@ -137,6 +326,21 @@ struct parsing_assigner
         parsing_assigner<Point, Dimension + 1, DimensionCount>::apply(
                         (finished ? it : ++it), end, point, wkt);
     }
+
+    static inline void apply(scanner& s, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        // Stop at end of tokens, or at "," ot ")"
+        coordinate_type value = coordinate_type();
+        if (! s.at_end() && ! s.is(',') && ! s.is(')'))
+        {
+            s.read(value);
+        }
+        set<Dimension>(point, value);
+
+        parsing_assigner<Point, Dimension + 1, DimensionCount>::apply(s, point);
+    }
 };
 
 template <typename Point, std::size_t DimensionCount>
@@ -146,6 +350,10 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
                 std::string const&)
     {
     }
+
+    static inline void apply(scanner&, Point&)
+    {
+    }
 };
 
 
@@ -224,6 +432,28 @@ struct container_inserter
 
         handle_close_parenthesis(it, end, wkt);
     }
+
+    template <typename OutputIterator>
+    static inline void apply(scanner& s, OutputIterator out)
+    {
+        s.open_parenthesis();
+
+        Point point;
+        while (! s.at_end() && ! s.is(')'))
+        {
+            parsing_assigner
+                <
+                    Point,
+                    0,
+                    dimension<Point>::value
+                >::apply(s, point);
+            out = point;
+            ++out;
+            s.accept(',');
+        }
+
+        s.close_parenthesis();
+    }
 };
 
 
@@ -263,6 +493,27 @@ struct container_appender
 
         handle_close_parenthesis(it, end, wkt);
     }
+
+    static inline void apply(scanner& s, Geometry out)
+    {
+        s.open_parenthesis();
+
+        point_type point;
+        while (! s.at_end() && ! s.is(')'))
+        {
+            parsing_assigner
+                <
+                    point_type,
+                    0,
+                    dimension<point_type>::value
+                >::apply(s, point);
+
+            geometry::append(out, point);
+            s.accept(',');
+        }
+
+        s.close_parenthesis();
+    }
 };
 
 /*!
@@ -279,6 +530,13 @@ struct point_parser
         parsing_assigner<P, 0, dimension<P>::value>::apply(it, end, point, wkt);
         handle_close_parenthesis(it, end, wkt);
     }
+
+    static inline void apply(scanner& s, P& point)
+    {
+        s.open_parenthesis();
+        parsing_assigner<P, 0, dimension<P>::value>::apply(s, point);
+        s.close_parenthesis();
+    }
 };
 
 
@@ -290,6 +548,11 @@ struct linestring_parser
     {
         container_appender<Geometry&>::apply(it, end, wkt, geometry);
     }
+
+    static inline void apply(scanner& s, Geometry& geometry)
+    {
+        container_appender<Geometry&>::apply(s, geometry);
+    }
 };
 
 
@@ -306,6 +569,13 @@ struct ring_parser
         container_appender<Ring&>::apply(it, end, wkt, ring);
         handle_close_parenthesis(it, end, wkt);
     }
+
+    static inline void apply(scanner& s, Ring& ring)
+    {
+        s.open_parenthesis();
+        container_appender<Ring&>::apply(s, ring);
+        s.close_parenthesis();
+    }
 };
 
 
@@ -357,6 +627,35 @@ struct polygon_parser
 
         handle_close_parenthesis(it, end, wkt);
     }
+
+    static inline void apply(scanner& s, Polygon& poly)
+    {
+        s.open_parenthesis();
+
+        int n = -1;
+        while (! s.at_end() && ! s.is(')'))
+        {
+            if (++n == 0)
+            {
+                appender::apply(s, exterior_ring(poly));
+            }
+            else
+            {
+                typename ring_type<Polygon>::type ring;
+                appender::apply(s, ring);
+                traits::push_back
+                    <
+                        typename boost::remove_reference
+                        <
+                            typename traits::interior_mutable_type<Polygon>::type
+                        >::type
+                    >::apply(interior_rings(poly), ring);
+            }
+            s.accept(',');
+        }
+
+        s.close_parenthesis();
+    }
 };
 
 
@@ -408,6 +707,39 @@ inline void handle_empty_z_m(tokenizer::iterator& it, tokenizer::iterator end,
     }
 }
 
+inline void handle_empty_z_m(scanner& s,
+            bool& has_empty, bool& has_z, bool& has_m)
+{
+    has_empty = false;
+    has_z = false;
+    has_m = false;
+
+    for (;;)
+    {
+        if (s.accept_word("M"))
+        {
+            has_m = true;
+        }
+        else if (s.accept_word("Z"))
+        {
+            has_z = true;
+        }
+        else if (s.accept_word("EMPTY"))
+        {
+            has_empty = true;
+        }
+        else if (s.accept_word("MZ") || s.accept_word("ZM"))
+        {
+            has_m = true;
+            has_z = true;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
 /*!
 \brief Internal, starts parsing
 \param tokens boost tokens, parsed with separator " " and keeping separator "()"
@@ -452,6 +784,39 @@ inline bool initialize(tokenizer const& tokens,
     throw read_wkt_exception(std::string("Should start with '") + geometry_name + "'", wkt);
 }
 
+template <typename Geometry>
+inline bool initialize(scanner& s, char const* geometry_name)
+{
+    if (s.accept_word(geometry_name))
+    {
+        bool has_empty, has_z, has_m;
+
+        handle_empty_z_m(s, has_empty, has_z, has_m);
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4127)
+#endif
+
+        if (has_z && dimension<Geometry>::type::value < 3)
+        {
+            throw read_wkt_exception("Z only allowed for 3 or more dimensions", s.wkt());
+        }
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+        if (has_empty)
+        {
+            s.check_end();
+            return false;
+        }
+        return true;
+    }
+    throw read_wkt_exception(std::string("Should start with '") + geometry_name + "'", s.wkt());
+}
+
 
 template <typename Geometry, template<typename> class Parser, typename PrefixPolicy>
 struct geometry_parser
@@ -468,6 +833,17 @@ struct geometry_parser
             check_end(it, tokens.end(), wkt);
         }
     }
+
+    static inline void apply(scanner& s, Geometry& geometry)
+    {
+        geometry::clear(geometry);
+
+        if (initialize<Geometry>(s, PrefixPolicy::apply()))
+        {
+            Parser<Geometry>::apply(s, geometry);
+            s.check_end();
+        }
+    }
 };
 
 
@@ -504,6 +880,31 @@ struct multi_parser
 
         check_end(it, tokens.end(), wkt);
     }
+
+    static inline void apply(scanner& s, MultiGeometry& geometry)
+    {
+        traits::clear<MultiGeometry>::apply(geometry);
+
+        if (initialize<MultiGeometry>(s, PrefixPolicy::apply()))
+        {
+            s.open_parenthesis();
+
+            // Parse sub-geometries
+            while (! s.at_end() && ! s.is(')'))
+            {
+                traits::resize<MultiGeometry>::apply(geometry, boost::size(geometry) + 1);
+                Parser
+                    <
+                        typename boost::range_value<MultiGeometry>::type
+                    >::apply(s, *(boost::end(geometry) - 1));
+                s.accept(',');
+            }
+
+            s.close_parenthesis();
+        }
+
+        s.check_end();
+    }
 };
 
 template <typename P>
@@ -514,6 +915,11 @@ struct noparenthesis_point_parser
     {
         parsing_assigner<P, 0, dimension<P>::value>::apply(it, end, point, wkt);
     }
+
+    static inline void apply(scanner& s, P& point)
+    {
+        parsing_assigner<P, 0, dimension<P>::value>::apply(s, point);
+    }
 };
 
 template <typename MultiGeometry, typename PrefixPolicy>
@@ -565,6 +971,41 @@ struct multi_point_parser
 
         check_end(it, tokens.end(), wkt);
     }
+
+    static inline void apply(scanner& s, MultiGeometry& geometry)
+    {
+        typedef typename boost::range_value<MultiGeometry>::type point_type;
+
+        traits::clear<MultiGeometry>::apply(geometry);
+
+        if (initialize<MultiGeometry>(s, PrefixPolicy::apply()))
+        {
+            s.open_parenthesis();
+
+            // If first point definition starts with "(" then parse points as (x y)
+            // otherwise as "x y"
+            bool const using_brackets = s.is('(');
+
+            while (! s.at_end() && ! s.is(')'))
+            {
+                traits::resize<MultiGeometry>::apply(geometry, boost::size(geometry) + 1);
+
+                if (using_brackets)
+                {
+                    point_parser<point_type>::apply(s, *(boost::end(geometry) - 1));
+                }
+                else
+                {
+                    noparenthesis_point_parser<point_type>::apply(s, *(boost::end(geometry) - 1));
+                }
+                s.accept(',');
+            }
+
+            s.close_parenthesis();
+        }
+
+        s.check_end();
+    }
 };
 
 
@@ -617,6 +1058,47 @@ struct box_parser
         }
         check_end(it, end, wkt);
 
+        assign_corners(points, box, wkt);
+    }
+
+    static inline void apply(scanner& s, Box& box)
+    {
+        bool should_close = false;
+        if (s.accept_word("POLYGON"))
+        {
+            bool has_empty, has_z, has_m;
+            handle_empty_z_m(s, has_empty, has_z, has_m);
+            if (has_empty)
+            {
+                assign_zero(box);
+                return;
+            }
+            s.open_parenthesis();
+            should_close = true;
+        }
+        else if (! s.accept_word("BOX"))
+        {
+            throw read_wkt_exception("Should start with 'POLYGON' or 'BOX'", s.wkt());
+        }
+
+        typedef typename point_type<Box>::type point_type;
+        std::vector<point_type> points;
+        container_inserter<point_type>::apply(s, std::back_inserter(points));
+
+        if (should_close)
+        {
+            s.close_parenthesis();
+        }
+        s.check_end();
+
+        assign_corners(points, box, s.wkt());
+    }
+
+private :
+    template <typename Points>
+    static inline void assign_corners(Points const& points, Box& box,
+                std::string const& wkt)
+    {
         int index = 0;
         std::size_t n = boost::size(points);
         if (n == 2)
@@ -671,6 +1153,30 @@ struct segment_parser
 
         check_end(it, end, wkt);
 
+        assign_points(points, segment, wkt);
+    }
+
+    static inline void apply(scanner& s, Segment& segment)
+    {
+        if (! s.accept_word("SEGMENT") && ! s.accept_word("LINESTRING"))
+        {
+            throw read_wkt_exception("Should start with 'LINESTRING' or 'SEGMENT'", s.wkt());
+        }
+
+        typedef typename point_type<Segment>::type point_type;
+        std::vector<point_type> points;
+        container_inserter<point_type>::apply(s, std::back_inserter(points));
+
+        s.check_end();
+
+        assign_points(points, segment, s.wkt());
+    }
+
+private :
+    template <typename Points>
+    static inline void assign_points(Points const& points, Segment& segment,
+                std::string const& wkt)
+    {
         if (boost::size(points) == 2)
         {
             geometry::detail::assign_point_to_index<0>(points.front(), segment);
@@ -680,7 +1186,6 @@ struct segment_parser
         {
             throw read_wkt_exception("Segment should have 2 points", wkt);
         }
-
     }
 };
 
@@ -800,6 +1305,27 @@ inline void read_wkt(std::string const& wkt, Geometry& geometry)
     dispatch::read_wkt<typename tag<Geometry>::type, Geometry>::apply(wkt, geometry);
 }
 
+/*!
+\brief Parses OGC Well-Known Text (\ref WKT) from a range of characters
+    into a geometry (any geometry)
+\details The characters are scanned in one pass, without tokenizing and
+    without allocating strings, and coordinates are converted by a fast
+    number parser. Results and exceptions are the same as for the version
+    taking a string, besides that tabs and newlines are handled as spaces.
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param first pointer to the first character of the \ref WKT
+\param last pointer past the last character of the \ref WKT
+\param geometry \param_geometry output geometry
+*/
+template <typename Geometry>
+inline void read_wkt(char const* first, char const* last, Geometry& geometry)
+{
+    geometry::concept::check<Geometry>();
+    detail::wkt::scanner s(first, last);
+    dispatch::read_wkt<typename tag<Geometry>::type, Geometry>::apply(s, geometry);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_WKT_READ_HPP
@@ -0,0 +1,443 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_STREAM_READER_HPP
+#define BOOST_GEOMETRY_IO_WKT_STREAM_READER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+// Parses a geometry which is a member of a multi-geometry, such that
+// multi-geometries can be read member by member
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct member_parser
+{
+    static const bool enabled = false;
+    static inline const char* multi_prefix() { return ""; }
+    static inline void apply(scanner&, Geometry&) {}
+};
+
+template <typename Point>
+struct member_parser<Point, point_tag>
+{
+    static const bool enabled = true;
+    static inline const char* multi_prefix() { return prefix_multipoint::apply(); }
+
+    static inline void apply(scanner& s, Point& point)
+    {
+        // Members of a multi-point are formatted as (x y) or as x y
+        if (s.is('('))
+        {
+            point_parser<Point>::apply(s, point);
+        }
+        else
+        {
+            noparenthesis_point_parser<Point>::apply(s, point);
+        }
+    }
+};
+
+template <typename Linestring>
+struct member_parser<Linestring, linestring_tag>
+    : linestring_parser<Linestring>
+{
+    static const bool enabled = true;
+    static inline const char* multi_prefix() { return prefix_multilinestring::apply(); }
+};
+
+template <typename Polygon>
+struct member_parser<Polygon, polygon_tag>
+    : polygon_parser<Polygon>
+{
+    static const bool enabled = true;
+    static inline const char* multi_prefix() { return prefix_multipolygon::apply(); }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads a sequence of geometries in \ref WKT one by one, from a stream
+    or from a range of characters
+\details The geometries in the input are separated by whitespace. Only the
+    WKT of the geometry being read is kept in memory, in a buffer which is
+    reused and only grows if a geometry does not fit. A range of characters
+    (for example a memory-mapped file) is read without copying.
+    If a point, linestring or polygon is read, and the input contains a
+    multi-geometry of that type, its members are read one by one. So a
+    large MULTIPOLYGON is processed polygon by polygon, in bounded memory.
+\ingroup wkt
+\qbk{
+[heading Example]
+\code
+wkt_stream_reader reader(file);
+polygon_type polygon;
+while (reader.read(polygon))
+{
+    // process polygon, which is reused for the next one
+}
+\endcode
+}
+*/
+class wkt_stream_reader
+{
+public :
+    /*!
+    \brief Constructs the reader on a stream, which is read in chunks
+        of the specified size
+    */
+    explicit wkt_stream_reader(std::istream& stream,
+                std::size_t chunk_size = 65536)
+        : m_stream(&stream)
+        , m_chunk_size(chunk_size > 0 ? chunk_size : 1)
+        , m_data(NULL)
+        , m_position(0)
+        , m_size(0)
+        , m_in_multi(false)
+        , m_multi_prefix("")
+    {}
+
+    /*!
+    \brief Constructs the reader on a range of characters, which should
+        stay valid while it is read
+    */
+    wkt_stream_reader(char const* first, char const* last)
+        : m_stream(NULL)
+        , m_chunk_size(0)
+        , m_data(first)
+        , m_position(0)
+        , m_size(last - first)
+        , m_in_multi(false)
+        , m_multi_prefix("")
+    {}
+
+    /*!
+    \brief Reads the next geometry, or the next member of a multi-geometry
+    \return false if the input is completely read
+    \note Throws read_wkt_exception, like read_wkt, if the input is invalid
+    */
+    template <typename Geometry>
+    inline bool read(Geometry& geometry)
+    {
+        concept::check<Geometry>();
+
+        typedef detail::wkt::member_parser<Geometry> member_parser;
+
+        for (;;)
+        {
+            skip_spaces();
+
+            if (m_in_multi)
+            {
+                if (current_is(')'))
+                {
+                    // The multi-geometry is completely read
+                    m_position++;
+                    m_in_multi = false;
+                    continue;
+                }
+                if (! member_parser::enabled
+                    || std::strcmp(m_multi_prefix, member_parser::multi_prefix()) != 0)
+                {
+                    throw read_wkt_exception(
+                        std::string("Cannot read a member of a ") + m_multi_prefix,
+                        current_wkt());
+                }
+
+                std::size_t const length = member_length();
+                detail::wkt::scanner s(m_data + m_position, m_data + m_position + length);
+                geometry::clear(geometry);
+                member_parser::apply(s, geometry);
+                s.check_end();
+
+                m_position += length;
+
+                // Members are separated by ',' and the last is followed by
+                // ')', which is handled in the next call
+                skip_spaces();
+                if (current_is(','))
+                {
+                    m_position++;
+                    skip_spaces();
+                    if (current_is(')'))
+                    {
+                        std::string const wkt = current_wkt();
+                        throw read_wkt_exception("Expected a member",
+                            m_data + m_position, m_data + m_size, wkt);
+                    }
+                }
+                else if (! current_is(')'))
+                {
+                    std::string const wkt = current_wkt();
+                    throw read_wkt_exception("Expected ',' or ')'",
+                        m_data + m_position, m_data + m_size, wkt);
+                }
+                return true;
+            }
+
+            if (! available(0))
+            {
+                return false;
+            }
+
+            if (member_parser::enabled
+                && starts_with_word(member_parser::multi_prefix()))
+            {
+                // Read the prefix of the multi-geometry, its members are
+                // read in the next calls
+                std::size_t const length = geometry_length(false);
+                detail::wkt::scanner s(m_data + m_position, m_data + m_position + length);
+                bool const has_members = detail::wkt::initialize<Geometry>(s,
+                            member_parser::multi_prefix());
+                m_position += length;
+
+                if (has_members)
+                {
+                    skip_spaces();
+                    if (! current_is('('))
+                    {
+                        std::string const wkt = current_wkt();
+                        throw read_wkt_exception("Expected '('",
+                            m_data + m_position, m_data + m_size, wkt);
+                    }
+                    m_position++;
+                    m_in_multi = true;
+                    m_multi_prefix = member_parser::multi_prefix();
+                }
+                continue;
+            }
+
+            std::size_t const length = geometry_length(true);
+            detail::wkt::scanner s(m_data + m_position, m_data + m_position + length);
+            dispatch::read_wkt
+                <
+                    typename tag<Geometry>::type,
+                    Geometry
+                >::apply(s, geometry);
+            m_position += length;
+            return true;
+        }
+    }
+
+private :
+
+    // Reads the next chunk from the stream, keeping the characters not
+    // yet read at the start of the buffer
+    inline bool refill()
+    {
+        if (m_stream == NULL || ! m_stream->good())
+        {
+            return false;
+        }
+
+        std::size_t const remaining = m_size - m_position;
+        if (remaining > 0 && m_position > 0)
+        {
+            std::memmove(&m_buffer[0], &m_buffer[m_position], remaining);
+        }
+        m_position = 0;
+        m_size = remaining;
+
+        if (m_buffer.size() < m_size + m_chunk_size)
+        {
+            m_buffer.resize((std::max)(2 * m_buffer.size(), m_size + m_chunk_size));
+        }
+
+        m_stream->read(&m_buffer[m_size], m_chunk_size);
+        m_size += static_cast<std::size_t>(m_stream->gcount());
+        m_data = &m_buffer[0];
+        return m_size > remaining;
+    }
+
+    // Returns true if the character at the offset (from the current
+    // position) is available, reading from the stream if necessary
+    inline bool available(std::size_t offset)
+    {
+        while (m_position + offset >= m_size)
+        {
+            if (! refill())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline char at(std::size_t offset) const
+    {
+        return m_data[m_position + offset];
+    }
+
+    inline bool current_is(char c)
+    {
+        return available(0) && at(0) == c;
+    }
+
+    inline void skip_spaces()
+    {
+        while (available(0) && detail::wkt::is_space(at(0)))
+        {
+            m_position++;
+        }
+    }
+
+    static inline char upper(char c)
+    {
+        return c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c;
+    }
+
+    inline bool is_token_end(std::size_t offset)
+    {
+        return ! available(offset)
+            || detail::wkt::is_space(at(offset))
+            || detail::wkt::is_separator(at(offset));
+    }
+
+    inline bool starts_with_word(char const* word)
+    {
+        std::size_t i = 0;
+        for ( ; word[i] != '\0'; i++)
+        {
+            if (! available(i) || upper(at(i)) != word[i])
+            {
+                return false;
+            }
+        }
+        return is_token_end(i);
+    }
+
+    // Returns the offset after the parenthesized part starting at the
+    // offset, or the offset itself if it does not start with "("
+    inline std::size_t balanced_end(std::size_t i)
+    {
+        if (! available(i) || at(i) != '(')
+        {
+            return i;
+        }
+
+        int depth = 0;
+        for ( ; available(i); i++)
+        {
+            if (at(i) == '(')
+            {
+                depth++;
+            }
+            else if (at(i) == ')' && --depth == 0)
+            {
+                return i + 1;
+            }
+        }
+        // Incomplete, reported by the parser
+        return i;
+    }
+
+    // Returns the length of the geometry starting at the current position:
+    // its tokens (such as POLYGON, Z, EMPTY) and, if specified, its
+    // coordinates within parentheses
+    inline std::size_t geometry_length(bool with_coordinates)
+    {
+        std::size_t i = 0;
+        for (;;)
+        {
+            while (available(i) && detail::wkt::is_space(at(i)))
+            {
+                i++;
+            }
+            if (! available(i) || detail::wkt::is_separator(at(i)))
+            {
+                break;
+            }
+
+            std::size_t const start = i;
+            while (! is_token_end(i))
+            {
+                i++;
+            }
+
+            static char const empty[] = "EMPTY";
+            if (i - start == 5)
+            {
+                bool is_empty = true;
+                for (std::size_t j = 0; j < 5; j++)
+                {
+                    is_empty = is_empty && upper(at(start + j)) == empty[j];
+                }
+                if (is_empty)
+                {
+                    return i;
+                }
+            }
+        }
+        return with_coordinates ? balanced_end(i) : i;
+    }
+
+    // Returns the length of the member starting at the current position,
+    // within parentheses or (for multi-points) until the next "," or ")"
+    inline std::size_t member_length()
+    {
+        if (current_is('('))
+        {
+            return balanced_end(0);
+        }
+
+        std::size_t i = 0;
+        while (available(i) && at(i) != ',' && at(i) != ')')
+        {
+            i++;
+        }
+        return i;
+    }
+
+    // Returns the start of the WKT at the current position, as reported
+    // in exceptions
+    inline std::string current_wkt()
+    {
+        available(100);
+        std::size_t const n = (std::min)(std::size_t(100), m_size - m_position);
+        return std::string(m_data + m_position, n);
+    }
+
+    std::istream* m_stream;
+    std::size_t m_chunk_size;
+    std::vector<char> m_buffer;
+
+    // Characters available, either in the buffer or in the range
+    char const* m_data;
+    std::size_t m_position;
+    std::size_t m_size;
+
+    bool m_in_multi;
+    char const* m_multi_prefix;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_STREAM_READER_HPP
@@ -37,6 +37,7 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 #include <boost/geometry/geometries/ring.hpp>
 
+#include <boost/geometry/io/detail/buffer_stream.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
 
 
@@ -56,8 +57,8 @@ namespace detail { namespace wkt
 template <typename P, int I, int Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, P const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, P const& p)
     {
         os << (I > 0 ? " " : "") << get<I>(p);
         stream_coordinate<P, I + 1, Count>::apply(os, p);
@@ -67,8 +68,8 @@ struct stream_coordinate
 template <typename P, int Count>
 struct stream_coordinate<P, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, P const&)
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, P const&)
     {}
 };
 
@@ -104,8 +105,8 @@ struct double_closing_parenthesis
 template <typename Point, typename Policy>
 struct wkt_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, Point const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, Point const& p)
     {
         os << Policy::apply() << "(";
         stream_coordinate<Point, 0, dimension<Point>::type::value>::apply(os, p);
@@ -120,8 +121,8 @@ struct wkt_point
 template <typename Range, typename PrefixPolicy, typename SuffixPolicy>
 struct wkt_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range, bool force_closed)
     {
         typedef typename boost::range_iterator<Range const>::type iterator_type;
@@ -158,8 +159,8 @@ struct wkt_range
         os << SuffixPolicy::apply();
     }
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range)
     {
         apply(os, range, false);
@@ -186,8 +187,8 @@ struct wkt_sequence
 template <typename Polygon, typename PrefixPolicy>
 struct wkt_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly)
     {
         typedef typename ring_type<Polygon const>::type ring;
@@ -213,8 +214,8 @@ struct wkt_poly
 template <typename Multi, typename StreamPolicy, typename PrefixPolicy>
 struct wkt_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Multi const& geometry)
     {
         os << PrefixPolicy::apply();
@@ -242,8 +243,8 @@ struct wkt_box
 {
     typedef typename point_type<Box>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box)
     {
         // Convert to ring, then stream
@@ -270,8 +271,8 @@ struct wkt_segment
 {
     typedef typename point_type<Segment>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Segment const& segment)
     {
         // Convert to two points, then stream
@@ -500,6 +501,31 @@ inline wkt_manipulator<Geometry> wkt(Geometry const& geometry)
     return wkt_manipulator<Geometry>(geometry);
 }
 
+/*!
+\brief Writes a geometry as \ref WKT into a buffer of characters
+\details Appends to a growable buffer (such as std::string or
+    std::vector<char>), formatting coordinates directly, without streams,
+    locales or virtual calls. By default coordinates are formatted with the
+    shortest representation which reads back to the same value.
+\tparam Geometry \tparam_geometry
+\tparam Buffer growable range of characters
+\param geometry \param_geometry
+\param buffer buffer of characters, to which the \ref WKT is appended
+\param precision number of significant digits of coordinates (as the
+    precision of a stream), or 0 for the shortest representation reading
+    back exactly
+\ingroup wkt
+*/
+template <typename Geometry, typename Buffer>
+inline void write_wkt(Geometry const& geometry, Buffer& buffer,
+            int precision = 0)
+{
+    concept::check<Geometry const>();
+
+    detail::io::buffer_stream<Buffer> os(buffer, precision);
+    dispatch::devarianted_wkt<Geometry>::apply(os, geometry);
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)  
 #endif
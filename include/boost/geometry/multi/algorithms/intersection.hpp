@@ -190,7 +190,7 @@ struct clip_multi_linestring
     >
     static inline OutputIterator apply(MultiLinestring const& multi_linestring,
             Box const& box,
-            RobustPolicy const& robust_policy,
+            RobustPolicy const& ,
             OutputIterator out, Strategy const& )
     {
         typedef typename point_type<LinestringOut>::type point_type;
@@ -200,7 +200,41 @@ struct clip_multi_linestring
             it != boost::end(multi_linestring); ++it)
         {
             out = detail::intersection::clip_range_with_box
-                <LinestringOut>(box, *it, robust_policy, out, lb_strategy);
+                <LinestringOut>(box, *it, out, lb_strategy);
+        }
+        return out;
+    }
+};
+
+
+// Clips each polygon separately, the polygons of a valid multi-polygon
+// do not overlap, and neither do their clipped results
+template
+<
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_multi_polygon_box
+{
+    template
+    <
+        typename MultiPolygon, typename Box,
+        typename RobustPolicy,
+        typename OutputIterator, typename Strategy
+    >
+    static inline OutputIterator apply(MultiPolygon const& multi_polygon,
+            Box const& box,
+            RobustPolicy const& robust_policy,
+            OutputIterator out, Strategy const& strategy)
+    {
+        for (typename boost::range_iterator<MultiPolygon const>::type it
+            = boost::begin(multi_polygon);
+            it != boost::end(multi_polygon); ++it)
+        {
+            out = intersection_areal_box
+                <
+                    GeometryOut, Reverse1, Reverse2, ReverseOut
+                >::apply(*it, box, robust_policy, out, strategy);
         }
         return out;
     }
@@ -283,6 +317,27 @@ struct intersection_insert
 {};
 
 
+template
+<
+    typename MultiPolygon, typename Box,
+    typename GeometryOut,
+    bool Reverse1, bool Reverse2, bool ReverseOut
+>
+struct intersection_insert
+    <
+        MultiPolygon, Box,
+        GeometryOut,
+        overlay_intersection,
+        Reverse1, Reverse2, ReverseOut,
+        multi_polygon_tag, box_tag, polygon_tag,
+        true, true, true
+    > : detail::intersection::intersection_multi_polygon_box
+            <
+                GeometryOut, Reverse1, Reverse2, ReverseOut
+            >
+{};
+
+
 template
 <
     typename Linestring, typename MultiPolygon,
@@ -0,0 +1,28 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_POLICIES_ROBUSTNESS_BASE_ROBUST_POLICY_HPP
+#define BOOST_GEOMETRY_POLICIES_ROBUSTNESS_BASE_ROBUST_POLICY_HPP
+
+namespace boost { namespace geometry
+{
+
+// Meta-function to typedef the policy a robust policy behaves as, such that
+// specializations for that policy are selected for policies wrapping it
+template <typename Policy>
+struct base_robust_policy
+{
+    // By default, the policy itself is the base policy
+    typedef Policy type;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_POLICIES_ROBUSTNESS_BASE_ROBUST_POLICY_HPP
@@ -19,6 +19,8 @@
 
 #include <boost/range.hpp>
 
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/strategies/convex_hull.hpp>
@@ -27,6 +29,8 @@
 
 #include <boost/geometry/policies/compare.hpp>
 
+#include <boost/geometry/util/select_most_precise.hpp>
+
 #include <boost/geometry/algorithms/detail/for_each_range.hpp>
 #include <boost/geometry/views/reversible_view.hpp>
 
@@ -42,6 +46,99 @@ namespace detail
 {
 
 
+// Akl-Toussaint heuristic: the points extreme in x, y, x+y and x-y form an
+// octagon inside the convex hull. Points strictly inside the box inscribed
+// in that octagon are strictly inside the hull and can be discarded before
+// sorting. The box is only used if the octagon is convex and ordered as
+// expected, which is verified on the coordinates themselves, such that the
+// hull is the same as without the box.
+template <typename Point>
+struct inner_box
+{
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+    typedef typename select_most_precise
+        <
+            coordinate_type, double
+        >::type calculation_type;
+
+    // Minimized keys: x, x+y, y, y-x, -x, -x-y, -y, x-y. This is the order
+    // of the extremes along the hull (counter clockwise, from the left)
+    Point extremes[8];
+    calculation_type keys[8];
+    bool first;
+
+    coordinate_type min_x, min_y, max_x, max_y;
+    bool valid;
+
+    inline inner_box()
+        : first(true)
+        , valid(false)
+    {}
+
+    inline void update(Point const& p)
+    {
+        calculation_type const x = geometry::get<0>(p);
+        calculation_type const y = geometry::get<1>(p);
+        calculation_type const k[8] = { x, x + y, y, y - x, -x, -x - y, -y, x - y };
+
+        for (int i = 0; i < 8; i++)
+        {
+            if (first || k[i] < keys[i])
+            {
+                keys[i] = k[i];
+                extremes[i] = p;
+            }
+        }
+        first = false;
+    }
+
+    inline void finalize()
+    {
+        if (first)
+        {
+            return;
+        }
+
+        // Along the lower left part, x increases and y decreases, etc.
+        valid = chain<1, -1>(0, 2) && chain<1, 1>(2, 4)
+            && chain<-1, 1>(4, 6) && chain<-1, -1>(6, 8);
+
+        min_x = (std::max)(x(7), (std::max)(x(0), x(1)));
+        max_x = (std::min)(x(3), (std::min)(x(4), x(5)));
+        min_y = (std::max)(y(1), (std::max)(y(2), y(3)));
+        max_y = (std::min)(y(5), (std::min)(y(6), y(7)));
+
+        valid = valid && min_x < max_x && min_y < max_y;
+    }
+
+    inline bool inside(Point const& p) const
+    {
+        return valid
+            && geometry::get<0>(p) > min_x && geometry::get<0>(p) < max_x
+            && geometry::get<1>(p) > min_y && geometry::get<1>(p) < max_y;
+    }
+
+private :
+    inline coordinate_type x(int i) const { return geometry::get<0>(extremes[i]); }
+    inline coordinate_type y(int i) const { return geometry::get<1>(extremes[i]); }
+
+    template <int DirectionX, int DirectionY>
+    inline bool chain(int begin, int end) const
+    {
+        for (int i = begin; i < end; i++)
+        {
+            int const next = (i + 1) % 8;
+            if ((DirectionX > 0 ? x(next) < x(i) : x(next) > x(i))
+                || (DirectionY > 0 ? y(next) < y(i) : y(next) > y(i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
 template
 <
     typename InputRange,
@@ -54,6 +151,7 @@ struct get_extremes
     typedef typename point_type<InputRange>::type point_type;
 
     point_type left, right;
+    inner_box<point_type> box;
 
     bool first;
 
@@ -80,10 +178,14 @@ struct get_extremes
         RangeIterator left_it = boost::begin(range);
         RangeIterator right_it = boost::begin(range);
 
+        box.update(*left_it);
+
         for (RangeIterator it = boost::begin(range) + 1;
             it != boost::end(range);
             ++it)
         {
+            box.update(*it);
+
             if (less(*it, *left_it))
             {
                 left_it = it;
@@ -136,10 +238,13 @@ struct assign_range
 
     point_type const& most_left;
     point_type const& most_right;
+    inner_box<point_type> const& box;
 
-    inline assign_range(point_type const& left, point_type const& right)
+    inline assign_range(point_type const& left, point_type const& right,
+            inner_box<point_type> const& inner)
         : most_left(left)
         , most_right(right)
+        , box(inner)
     {}
 
     inline void apply(InputRange const& range)
@@ -151,6 +256,12 @@ struct assign_range
             it != boost::end(range);
             ++it)
         {
+            if (box.inside(*it))
+            {
+                // Inside the hull, never part of it
+                continue;
+            }
+
             // check if it is lying most_left or most_right from the line
 
             int dir = side::apply(most_left, most_right, *it);
@@ -250,6 +361,7 @@ public:
                 geometry::greater<point_type>
             > extremes;
         geometry::detail::for_each_range(geometry, extremes);
+        extremes.box.finalize();
 
         // Bounding left/right points
         // Second pass, now that extremes are found, assign all points
@@ -260,7 +372,7 @@ public:
                 range_iterator,
                 container_type,
                 typename strategy::side::services::default_strategy<cs_tag>::type
-            > assigner(extremes.left, extremes.right);
+            > assigner(extremes.left, extremes.right, extremes.box);
 
         geometry::detail::for_each_range(geometry, assigner);
 
@@ -42,6 +42,36 @@ struct default_strategy
 };
 
 
+/*!
+    \brief Traits class feeding the segments of a range of points to an
+        area strategy
+    \ingroup area
+    \details By default the segments are fed one by one. Strategies
+        processing the points in blocks specialize it.
+    \tparam Strategy area strategy
+*/
+template <typename Strategy>
+struct apply_range
+{
+    template <typename Iterator>
+    static inline void apply(Strategy const& strategy,
+                Iterator first, Iterator last,
+                typename Strategy::state_type& state)
+    {
+        if (first == last)
+        {
+            return;
+        }
+        for (Iterator previous = first++;
+            first != last;
+            ++previous, ++first)
+        {
+            strategy.apply(*previous, *first, state);
+        }
+    }
+};
+
+
 }}} // namespace strategy::area::services
 
 
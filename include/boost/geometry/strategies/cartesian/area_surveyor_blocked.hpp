@@ -0,0 +1,210 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_AREA_SURVEYOR_BLOCKED_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_AREA_SURVEYOR_BLOCKED_HPP
+
+
+#include <cstddef>
+
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_void.hpp>
+
+#include <boost/geometry/arithmetic/determinant.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/strategies/area.hpp>
+#include <boost/geometry/util/lane_sum.hpp>
+#include <boost/geometry/util/point_blocks.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace area
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Term of segment i of a block
+template <typename T>
+struct shoelace_term
+{
+    inline shoelace_term(T const* x_, T const* y_)
+        : x(x_)
+        , y(y_)
+    {}
+
+    inline T operator()(std::size_t i) const
+    {
+        // As surveyor: x2 * y1 - x1 * y2
+        return x[i + 1] * y[i] - x[i] * y[i + 1];
+    }
+
+    T const* x;
+    T const* y;
+};
+
+template <typename T, typename Sum>
+struct shoelace_kernel
+{
+    explicit inline shoelace_kernel(Sum& sum)
+        : m_sum(sum)
+    {}
+
+    inline void operator()(T const* x, T const* y, std::size_t count)
+    {
+        m_sum.add_block(shoelace_term<T>(x, y), count);
+    }
+
+    Sum& m_sum;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Area calculation for cartesian points, processing the points of
+    rings in blocks
+\ingroup strategies
+\details Calculates area using the Surveyor's formula, as surveyor does.
+    The area algorithm passes the points of each ring at once, they are
+    processed in blocks by loops which compilers can vectorize, and the
+    terms are summed in independent lanes. The result may therefore differ
+    in the last bits from the result of surveyor. It has the interface of
+    surveyor and can be passed to area. Other algorithms, which feed the
+    segments one by one, calculate the area as surveyor does.
+\tparam PointOfSegment \tparam_segment_point
+\tparam CalculationType \tparam_calculation
+\tparam Compensated if true, the terms are summed using Kahan summation,
+    such that the rounding error does not grow with the number of points
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.area.area_2_with_strategy area (with strategy)]
+}
+
+*/
+template
+<
+    typename PointOfSegment,
+    typename CalculationType = void,
+    bool Compensated = false
+>
+class surveyor_blocked
+{
+public :
+    typedef typename
+        boost::mpl::if_c
+        <
+            boost::is_void<CalculationType>::type::value,
+            typename select_most_precise
+            <
+                typename coordinate_type<PointOfSegment>::type,
+                double
+            >::type,
+            CalculationType
+        >::type return_type;
+
+private :
+
+    typedef geometry::detail::lane_sum<return_type, Compensated> sum_type;
+
+    class summation
+    {
+        friend class surveyor_blocked;
+
+        sum_type sum;
+    public :
+
+        inline summation()
+        {
+            // Strategy supports only 2D areas
+            assert_dimension<PointOfSegment, 2>();
+        }
+        inline return_type area() const
+        {
+            return_type result = sum.result();
+            return_type const two = 2;
+            result /= two;
+            return result;
+        }
+    };
+
+public :
+    typedef summation state_type;
+    typedef PointOfSegment segment_point_type;
+
+    static inline void apply(PointOfSegment const& p1,
+                PointOfSegment const& p2,
+                summation& state)
+    {
+        state.sum.add(geometry::detail::determinant<return_type>(p2, p1));
+    }
+
+    template <typename Iterator>
+    static inline void apply_points(Iterator first, Iterator last,
+                summation& state)
+    {
+        typedef geometry::detail::point_blocks<return_type> blocks_type;
+        typedef detail::shoelace_kernel
+            <
+                return_type, sum_type
+            > kernel_type;
+
+        blocks_type blocks;
+        kernel_type kernel(state.sum);
+        blocks.apply(first, last, kernel);
+    }
+
+    static inline return_type result(summation const& state)
+    {
+        return state.area();
+    }
+
+};
+
+
+namespace services
+{
+
+template <typename PointOfSegment, typename CalculationType, bool Compensated>
+struct apply_range
+    <
+        surveyor_blocked<PointOfSegment, CalculationType, Compensated>
+    >
+{
+    typedef surveyor_blocked
+        <
+            PointOfSegment, CalculationType, Compensated
+        > strategy_type;
+
+    template <typename Iterator>
+    static inline void apply(strategy_type const& ,
+                Iterator first, Iterator last,
+                typename strategy_type::state_type& state)
+    {
+        strategy_type::apply_points(first, last, state);
+    }
+};
+
+} // namespace services
+
+
+}} // namespace strategy::area
+
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_AREA_SURVEYOR_BLOCKED_HPP
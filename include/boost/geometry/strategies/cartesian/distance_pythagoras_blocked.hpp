@@ -0,0 +1,246 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_DISTANCE_PYTHAGORAS_BLOCKED_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_DISTANCE_PYTHAGORAS_BLOCKED_HPP
+
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+
+#include <boost/mpl/bool.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/cartesian/distance_pythagoras.hpp>
+#include <boost/geometry/util/lane_sum.hpp>
+#include <boost/geometry/util/point_blocks.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace distance
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Term of segment i of a block
+template <typename T>
+struct segment_length_term
+{
+    inline segment_length_term(T const* x_, T const* y_)
+        : x(x_)
+        , y(y_)
+    {}
+
+    inline T operator()(std::size_t i) const
+    {
+        T const dx = x[i + 1] - x[i];
+        T const dy = y[i + 1] - y[i];
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    T const* x;
+    T const* y;
+};
+
+template <typename T, typename Sum>
+struct segment_length_kernel
+{
+    explicit inline segment_length_kernel(Sum& sum)
+        : m_sum(sum)
+    {}
+
+    inline void operator()(T const* x, T const* y, std::size_t count)
+    {
+        m_sum.add_block(segment_length_term<T>(x, y), count);
+    }
+
+    Sum& m_sum;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Strategy to calculate the distance between two points, summing
+    the lengths of ranges of 2D points in blocks
+\ingroup strategies
+\details Behaves as pythagoras, also for distance and
+    comparable_distance. The length and perimeter algorithms pass
+    the points of each range at once. Points of two dimensions are processed
+    in blocks by loops which compilers can vectorize, and the segment
+    lengths are summed in independent lanes. The result may therefore
+    differ in the last bits from the result of pythagoras. Points of other
+    dimensions are processed segment by segment, as by pythagoras.
+\tparam CalculationType \tparam_calculation
+\tparam Compensated if true, the lengths are summed using Kahan summation,
+    such that the rounding error does not grow with the number of points
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.length.length_2_with_strategy length (with strategy)]
+}
+
+*/
+template <typename CalculationType = void, bool Compensated = false>
+class pythagoras_blocked : public pythagoras<CalculationType>
+{
+public :
+
+    template <typename ReturnType, typename Iterator>
+    static inline ReturnType sum_points(Iterator first, Iterator last)
+    {
+        typedef typename std::iterator_traits<Iterator>::value_type point_type;
+
+        // Blocks contain x and y only
+        assert_dimension<point_type, 2>();
+
+        typedef typename pythagoras<CalculationType>::template calculation_type
+            <
+                point_type, point_type
+            >::type calculation_type;
+
+        typedef geometry::detail::lane_sum
+            <
+                calculation_type, Compensated
+            > sum_type;
+        typedef geometry::detail::point_blocks<calculation_type> blocks_type;
+        typedef detail::segment_length_kernel
+            <
+                calculation_type, sum_type
+            > kernel_type;
+
+        sum_type sum;
+        blocks_type blocks;
+        kernel_type kernel(sum);
+        blocks.apply(first, last, kernel);
+        return ReturnType(sum.result());
+    }
+};
+
+
+namespace services
+{
+
+// Point-point distances are calculated as by pythagoras
+
+template <typename CalculationType, bool Compensated>
+struct tag<pythagoras_blocked<CalculationType, Compensated> >
+{
+    typedef strategy_tag_distance_point_point type;
+};
+
+
+template <typename CalculationType, bool Compensated, typename P1, typename P2>
+struct return_type<pythagoras_blocked<CalculationType, Compensated>, P1, P2>
+    : return_type<pythagoras<CalculationType>, P1, P2>
+{};
+
+
+template <typename CalculationType, bool Compensated>
+struct comparable_type<pythagoras_blocked<CalculationType, Compensated> >
+    : comparable_type<pythagoras<CalculationType> >
+{};
+
+
+template <typename CalculationType, bool Compensated>
+struct get_comparable<pythagoras_blocked<CalculationType, Compensated> >
+{
+    typedef typename comparable_type
+        <
+            pythagoras<CalculationType>
+        >::type comparable_type;
+public :
+    static inline comparable_type apply(
+                pythagoras_blocked<CalculationType, Compensated> const& )
+    {
+        return comparable_type();
+    }
+};
+
+
+template <typename CalculationType, bool Compensated, typename Point1, typename Point2>
+struct result_from_distance
+    <
+        pythagoras_blocked<CalculationType, Compensated>, Point1, Point2
+    >
+{
+private :
+    typedef typename return_type
+        <
+            pythagoras<CalculationType>, Point1, Point2
+        >::type return_type;
+public :
+    template <typename T>
+    static inline return_type apply(
+                pythagoras_blocked<CalculationType, Compensated> const& ,
+                T const& value)
+    {
+        return result_from_distance
+            <
+                pythagoras<CalculationType>, Point1, Point2
+            >::apply(pythagoras<CalculationType>(), value);
+    }
+};
+
+
+// Ranges of 2D points are processed in blocks, ranges of points of
+// other dimensions segment by segment, as by pythagoras
+template <typename CalculationType, bool Compensated>
+struct sum_range<pythagoras_blocked<CalculationType, Compensated> >
+{
+    template <typename ReturnType, typename Iterator>
+    static inline ReturnType apply(
+                pythagoras_blocked<CalculationType, Compensated> const& ,
+                Iterator first, Iterator last)
+    {
+        typedef typename std::iterator_traits<Iterator>::value_type point_type;
+        return apply<ReturnType>(first, last,
+            boost::mpl::bool_<geometry::dimension<point_type>::value == 2>());
+    }
+
+private :
+    template <typename ReturnType, typename Iterator>
+    static inline ReturnType apply(Iterator first, Iterator last,
+                boost::mpl::true_)
+    {
+        return pythagoras_blocked
+            <
+                CalculationType, Compensated
+            >::template sum_points<ReturnType>(first, last);
+    }
+
+    template <typename ReturnType, typename Iterator>
+    static inline ReturnType apply(Iterator first, Iterator last,
+                boost::mpl::false_)
+    {
+        return sum_range
+            <
+                pythagoras<CalculationType>
+            >::template apply<ReturnType>(pythagoras<CalculationType>(),
+                first, last);
+    }
+};
+
+} // namespace services
+
+
+}} // namespace strategy::distance
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_DISTANCE_PYTHAGORAS_BLOCKED_HPP
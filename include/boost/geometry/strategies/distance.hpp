@@ -102,6 +102,38 @@ struct default_strategy
 };
 
 
+/*!
+    \brief Traits class summing the distances between the consecutive
+        points of a range, for length and perimeter
+    \details By default the strategy is applied to each pair of points.
+        Strategies processing the points in blocks specialize it.
+    \tparam Strategy distance strategy
+*/
+template <typename Strategy>
+struct sum_range
+{
+    template <typename ReturnType, typename Iterator>
+    static inline ReturnType apply(Strategy const& strategy,
+                Iterator first, Iterator last)
+    {
+        ReturnType sum = ReturnType();
+        if (first == last)
+        {
+            return sum;
+        }
+        for (Iterator previous = first++;
+            first != last;
+            ++previous, ++first)
+        {
+            // Add point-point distance using the return type belonging
+            // to strategy
+            sum += strategy.apply(*previous, *first);
+        }
+        return sum;
+    }
+};
+
+
 }}} // namespace strategy::distance::services
 
 
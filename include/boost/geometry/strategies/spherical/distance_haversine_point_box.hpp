@@ -0,0 +1,377 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_SPHERICAL_DISTANCE_HAVERSINE_POINT_BOX_HPP
+#define BOOST_GEOMETRY_STRATEGIES_SPHERICAL_DISTANCE_HAVERSINE_POINT_BOX_HPP
+
+
+#include <cmath>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+
+#include <boost/geometry/strategies/distance.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/promote_floating_point.hpp>
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+#include <boost/geometry/views/detail/indexed_point_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+namespace strategy { namespace distance
+{
+
+
+namespace comparable
+{
+
+/*!
+\brief Strategy to calculate comparable distance between a point and a
+    box, for spherical coordinates
+\ingroup strategies
+\details The box is the region between two meridians and two parallels.
+    Its longitudes are taken modulo 360 degrees, such that boxes can cross
+    the antimeridian (then the minimal longitude is larger than the
+    maximal longitude). The comparable distance is the haversine of the
+    angle, as calculated by comparable::haversine, such that it can be
+    compared with comparable point-point distances.
+\tparam RadiusType \tparam_radius
+\tparam CalculationType \tparam_calculation
+*/
+template
+<
+    typename RadiusType,
+    typename CalculationType = void
+>
+class haversine_point_box
+{
+public :
+    template <typename Point, typename Box>
+    struct calculation_type
+        : promote_floating_point
+          <
+              typename select_calculation_type
+                  <
+                      Point,
+                      Box,
+                      CalculationType
+                  >::type
+          >
+    {};
+
+    typedef RadiusType radius_type;
+
+    explicit inline haversine_point_box(RadiusType const& r = 1.0)
+        : m_radius(r)
+    {}
+
+    template <typename Point, typename Box>
+    static inline typename calculation_type<Point, Box>::type
+    apply(Point const& point, Box const& box)
+    {
+        typedef typename calculation_type<Point, Box>::type calc_t;
+
+        geometry::detail::indexed_point_view<Box const, min_corner>
+            const min_point(box);
+        geometry::detail::indexed_point_view<Box const, max_corner>
+            const max_point(box);
+
+        return calculate<calc_t>(get_as_radian<0>(point),
+                get_as_radian<1>(point),
+                get_as_radian<0>(min_point), get_as_radian<1>(min_point),
+                get_as_radian<0>(max_point), get_as_radian<1>(max_point));
+    }
+
+    inline RadiusType radius() const
+    {
+        return m_radius;
+    }
+
+private :
+
+    template <typename T>
+    static inline T calculate(T const& lon, T const& lat,
+                T const& lon_min, T const& lat_min,
+                T const& lon_max, T const& lat_max)
+    {
+        T const two_pi = T(2) * geometry::math::pi<T>();
+
+        // Width of the box, and position of the point eastwards of its
+        // western meridian, in [0, 2pi)
+        T width = lon_max - lon_min;
+        if (width < 0)
+        {
+            width += two_pi;
+        }
+        T offset = std::fmod(lon - lon_min, two_pi);
+        if (offset < 0)
+        {
+            offset += two_pi;
+        }
+
+        if (offset <= width)
+        {
+            // Between the meridians: the nearest point is on the same
+            // meridian, on or between the parallels
+            return lat < lat_min ? math::hav(lat_min - lat)
+                : lat > lat_max ? math::hav(lat - lat_max)
+                : T(0);
+        }
+
+        // Outside the meridians: the nearest point is on the nearest
+        // meridian (eastwards or westwards). Points on the parallels are
+        // further away. On the great circle of that meridian, the nearest
+        // point has latitude atan2(sin(lat), cos(lat) * cos(dlon)). As the
+        // distance increases with the angle along the circle, it is clamped
+        // between the parallels
+        T const dlon = (std::min)(offset - width, two_pi - offset);
+        T const cos_lat = cos(lat);
+        T nearest_lat = atan2(sin(lat), cos_lat * cos(dlon));
+        if (nearest_lat < lat_min)
+        {
+            nearest_lat = lat_min;
+        }
+        else if (nearest_lat > lat_max)
+        {
+            nearest_lat = lat_max;
+        }
+
+        return math::hav(nearest_lat - lat)
+                + cos_lat * cos(nearest_lat) * math::hav(dlon);
+    }
+
+    RadiusType m_radius;
+};
+
+
+} // namespace comparable
+
+
+/*!
+\brief Strategy to calculate the distance between a point and a box,
+    for spherical coordinates on a perfect sphere
+\ingroup strategies
+\details The box is the region between two meridians and two parallels,
+    see comparable::haversine_point_box. The distance is the distance
+    to the nearest point of that region, calculated as haversine does.
+\tparam RadiusType \tparam_radius
+\tparam CalculationType \tparam_calculation
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.distance.distance_3_with_strategy distance (with strategy)]
+}
+
+*/
+template
+<
+    typename RadiusType,
+    typename CalculationType = void
+>
+class haversine_point_box
+{
+    typedef comparable::haversine_point_box
+        <
+            RadiusType, CalculationType
+        > comparable_type;
+
+public :
+    template <typename Point, typename Box>
+    struct calculation_type
+        : services::return_type<comparable_type, Point, Box>
+    {};
+
+    typedef RadiusType radius_type;
+
+    /*!
+    \brief Constructor
+    \param radius radius of the sphere, defaults to 1.0 for the unit sphere
+    */
+    inline haversine_point_box(RadiusType const& radius = 1.0)
+        : m_radius(radius)
+    {}
+
+    /*!
+    \brief applies the distance calculation
+    \return the calculated distance (including multiplying with radius)
+    \param point point
+    \param box box
+    */
+    template <typename Point, typename Box>
+    inline typename calculation_type<Point, Box>::type
+    apply(Point const& point, Box const& box) const
+    {
+        typedef typename calculation_type<Point, Box>::type calculation_type;
+        calculation_type const a = comparable_type::apply(point, box);
+        calculation_type const c = calculation_type(2.0) * asin(math::sqrt(a));
+        return m_radius * c;
+    }
+
+    /*!
+    \brief access to radius value
+    \return the radius
+    */
+    inline RadiusType radius() const
+    {
+        return m_radius;
+    }
+
+private :
+    RadiusType m_radius;
+};
+
+
+#ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
+namespace services
+{
+
+template <typename RadiusType, typename CalculationType>
+struct tag<haversine_point_box<RadiusType, CalculationType> >
+{
+    typedef strategy_tag_distance_point_box type;
+};
+
+
+template <typename RadiusType, typename CalculationType, typename P, typename B>
+struct return_type<haversine_point_box<RadiusType, CalculationType>, P, B>
+    : haversine_point_box<RadiusType, CalculationType>::template calculation_type<P, B>
+{};
+
+
+template <typename RadiusType, typename CalculationType>
+struct comparable_type<haversine_point_box<RadiusType, CalculationType> >
+{
+    typedef comparable::haversine_point_box<RadiusType, CalculationType> type;
+};
+
+
+template <typename RadiusType, typename CalculationType>
+struct get_comparable<haversine_point_box<RadiusType, CalculationType> >
+{
+private :
+    typedef haversine_point_box<RadiusType, CalculationType> this_type;
+    typedef comparable::haversine_point_box<RadiusType, CalculationType> comparable_type;
+public :
+    static inline comparable_type apply(this_type const& input)
+    {
+        return comparable_type(input.radius());
+    }
+};
+
+template <typename RadiusType, typename CalculationType, typename P, typename B>
+struct result_from_distance<haversine_point_box<RadiusType, CalculationType>, P, B>
+{
+private :
+    typedef haversine_point_box<RadiusType, CalculationType> this_type;
+    typedef typename return_type<this_type, P, B>::type return_type;
+public :
+    template <typename T>
+    static inline return_type apply(this_type const& , T const& value)
+    {
+        return return_type(value);
+    }
+};
+
+
+// Specializations for comparable::haversine_point_box
+template <typename RadiusType, typename CalculationType>
+struct tag<comparable::haversine_point_box<RadiusType, CalculationType> >
+{
+    typedef strategy_tag_distance_point_box type;
+};
+
+
+template <typename RadiusType, typename CalculationType, typename P, typename B>
+struct return_type<comparable::haversine_point_box<RadiusType, CalculationType>, P, B>
+    : comparable::haversine_point_box<RadiusType, CalculationType>::template calculation_type<P, B>
+{};
+
+
+template <typename RadiusType, typename CalculationType>
+struct comparable_type<comparable::haversine_point_box<RadiusType, CalculationType> >
+{
+    typedef comparable::haversine_point_box<RadiusType, CalculationType> type;
+};
+
+
+template <typename RadiusType, typename CalculationType>
+struct get_comparable<comparable::haversine_point_box<RadiusType, CalculationType> >
+{
+private :
+    typedef comparable::haversine_point_box<RadiusType, CalculationType> this_type;
+public :
+    static inline this_type apply(this_type const& input)
+    {
+        return input;
+    }
+};
+
+
+template <typename RadiusType, typename CalculationType, typename P, typename B>
+struct result_from_distance<comparable::haversine_point_box<RadiusType, CalculationType>, P, B>
+{
+private :
+    typedef comparable::haversine_point_box<RadiusType, CalculationType> strategy_type;
+    typedef typename return_type<strategy_type, P, B>::type return_type;
+public :
+    template <typename T>
+    static inline return_type apply(strategy_type const& strategy, T const& distance)
+    {
+        return_type const s = sin((distance / strategy.radius()) / return_type(2));
+        return s * s;
+    }
+};
+
+
+// Register it as the default for point-box combinations
+// in a spherical equatorial coordinate system
+template <typename Point, typename BoxPoint>
+struct default_strategy
+    <
+        point_tag, box_tag, Point, BoxPoint,
+        spherical_equatorial_tag, spherical_equatorial_tag
+    >
+{
+    typedef strategy::distance::haversine_point_box
+        <
+            typename select_coordinate_type<Point, BoxPoint>::type
+        > type;
+};
+
+template <typename BoxPoint, typename Point>
+struct default_strategy
+    <
+        box_tag, point_tag, BoxPoint, Point,
+        spherical_equatorial_tag, spherical_equatorial_tag
+    >
+{
+    typedef typename default_strategy
+        <
+            point_tag, box_tag, Point, BoxPoint,
+            spherical_equatorial_tag, spherical_equatorial_tag
+        >::type type;
+};
+
+
+} // namespace services
+#endif // DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
+
+
+}} // namespace strategy::distance
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_SPHERICAL_DISTANCE_HAVERSINE_POINT_BOX_HPP
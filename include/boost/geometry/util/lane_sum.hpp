@@ -0,0 +1,148 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_LANE_SUM_HPP
+#define BOOST_GEOMETRY_UTIL_LANE_SUM_HPP
+
+
+#include <cstddef>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+
+/*!
+\brief Sum of values, added in a number of independent lanes
+\details The additions of a block of values do not depend on each other,
+    such that compilers can vectorize them. If Compensated is true, each
+    lane uses Kahan summation, which keeps the rounding error independent
+    of the number of values.
+\note The result may differ in the last bits from adding the values one
+    by one, because the values are added in another order.
+*/
+template <typename T, bool Compensated, std::size_t Lanes = 8>
+class lane_sum
+{
+public :
+    inline lane_sum()
+    {
+        for (std::size_t j = 0; j < Lanes; j++)
+        {
+            m_sums[j] = T();
+            m_compensations[j] = T();
+        }
+    }
+
+    inline void add(T const& value)
+    {
+        add(0, value);
+    }
+
+    // Adds values[i] to lane i % Lanes. The additions to different lanes
+    // do not depend on each other and can be vectorized.
+    template <typename Values>
+    inline void add_block(Values const& values, std::size_t count)
+    {
+        std::size_t i = 0;
+        for (; i + Lanes <= count; i += Lanes)
+        {
+            for (std::size_t j = 0; j < Lanes; j++)
+            {
+                add(j, values(i + j));
+            }
+        }
+        for (std::size_t j = 0; i < count; i++, j++)
+        {
+            add(j, values(i));
+        }
+    }
+
+    inline T result() const
+    {
+        lane_sum<T, Compensated, 1> total;
+        for (std::size_t j = 0; j < Lanes; j++)
+        {
+            total.add(m_sums[j]);
+            if (Compensated)
+            {
+                total.add(-m_compensations[j]);
+            }
+        }
+        return total.result();
+    }
+
+private :
+    inline void add(std::size_t j, T const& value)
+    {
+        if (Compensated)
+        {
+            T const y = value - m_compensations[j];
+            T const t = m_sums[j] + y;
+            m_compensations[j] = (t - m_sums[j]) - y;
+            m_sums[j] = t;
+        }
+        else
+        {
+            m_sums[j] += value;
+        }
+    }
+
+    T m_sums[Lanes];
+    T m_compensations[Lanes];
+};
+
+
+template <typename T, bool Compensated>
+class lane_sum<T, Compensated, 1>
+{
+public :
+    inline lane_sum()
+        : m_sum()
+        , m_compensation()
+    {}
+
+    inline void add(T const& value)
+    {
+        if (Compensated)
+        {
+            T const y = value - m_compensation;
+            T const t = m_sum + y;
+            m_compensation = (t - m_sum) - y;
+            m_sum = t;
+        }
+        else
+        {
+            m_sum += value;
+        }
+    }
+
+    inline T result() const
+    {
+        return Compensated ? m_sum - m_compensation : m_sum;
+    }
+
+private :
+    T m_sum;
+    T m_compensation;
+};
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_LANE_SUM_HPP
@@ -0,0 +1,90 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_POINT_BLOCKS_HPP
+#define BOOST_GEOMETRY_UTIL_POINT_BLOCKS_HPP
+
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/geometry/core/access.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+
+/*!
+\brief Walks through a range of 2D points in blocks
+\details The coordinates of each block are copied to arrays, per component,
+    and passed to a kernel processing the segments of that block. The
+    kernel loops over arrays and can be vectorized. Each block starts with
+    the last point of the previous block, such that all segments of the
+    range are processed.
+\tparam T calculation type, to which the coordinates are converted
+*/
+template <typename T, std::size_t BlockSize = 64>
+class point_blocks
+{
+public :
+    static const std::size_t block_size = BlockSize;
+
+    // Calls kernel(x, y, count) for each block, where the segments are
+    // (x[i], y[i]) - (x[i + 1], y[i + 1]), for i < count
+    template <typename Iterator, typename Kernel>
+    inline void apply(Iterator first, Iterator last, Kernel& kernel)
+    {
+        std::size_t remaining = std::distance(first, last);
+        if (remaining == 0)
+        {
+            return;
+        }
+
+        m_x[0] = geometry::get<0>(*first);
+        m_y[0] = geometry::get<1>(*first);
+        ++first;
+        --remaining;
+
+        while (remaining > 0)
+        {
+            std::size_t const count
+                = remaining < BlockSize ? remaining : BlockSize;
+            for (std::size_t i = 1; i <= count; i++, ++first)
+            {
+                m_x[i] = geometry::get<0>(*first);
+                m_y[i] = geometry::get<1>(*first);
+            }
+
+            kernel(m_x, m_y, count);
+
+            m_x[0] = m_x[count];
+            m_y[0] = m_y[count];
+            remaining -= count;
+        }
+    }
+
+private :
+    T m_x[BlockSize + 1];
+    T m_y[BlockSize + 1];
+};
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_POINT_BLOCKS_HPP
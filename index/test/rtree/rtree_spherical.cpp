@@ -0,0 +1,118 @@
+// Boost.Geometry Index
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_index_test_common.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/geometry/index/rtree.hpp>
+
+typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_type;
+typedef bg::model::box<point_type> box_type;
+
+// Points all over the globe, denser near the antimeridian
+std::vector<point_type> create_points()
+{
+    std::vector<point_type> points;
+    for (int i = 0; i < 360; i += 7)
+    {
+        for (int j = -85; j <= 85; j += 5)
+        {
+            points.push_back(point_type(-179.75 + i, j + 0.25));
+        }
+    }
+    for (int i = 0; i < 20; i++)
+    {
+        points.push_back(point_type(179.95 - i * 0.01, i * 0.5));
+        points.push_back(point_type(-179.95 + i * 0.01, -i * 0.5));
+    }
+    return points;
+}
+
+template <typename Geometry, typename Value>
+std::vector<double> distances(Geometry const& query, std::vector<Value> const& points)
+{
+    std::vector<double> result;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        result.push_back(bg::distance(query, points[i]));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// Compares the k nearest values found by the rtree with the k nearest
+// values found by brute force
+template <typename Rtree, typename Value>
+void test_nearest(Rtree const& rtree, std::vector<Value> const& values,
+                  point_type const& query, std::size_t k)
+{
+    std::vector<Value> found;
+    rtree.query(bgi::nearest(query, k), std::back_inserter(found));
+    BOOST_CHECK_EQUAL(found.size(), k);
+
+    std::vector<double> const expected = distances(query, values);
+    std::vector<double> const detected = distances(query, found);
+    for (std::size_t i = 0; i < k && i < detected.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(detected[i], expected[i], 0.0001);
+    }
+}
+
+template <typename Parameters>
+void test_rtree(Parameters const& parameters)
+{
+    std::vector<point_type> const points = create_points();
+    bgi::rtree<point_type, Parameters> rtree(points, parameters);
+
+    std::vector<point_type> queries;
+    queries.push_back(point_type(179.99, 0.1));
+    queries.push_back(point_type(-179.99, -0.1));
+    queries.push_back(point_type(4.9, 52.4));
+    queries.push_back(point_type(0, 89.9));
+    queries.push_back(point_type(100, -89.9));
+
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        test_nearest(rtree, points, queries[i], 1);
+        test_nearest(rtree, points, queries[i], 10);
+    }
+
+    // Boxes as values
+    std::vector<box_type> boxes;
+    for (std::size_t i = 0; i < points.size(); i += 3)
+    {
+        point_type const& p = points[i];
+        boxes.push_back(box_type(p, point_type(bg::get<0>(p) + 0.5, bg::get<1>(p) + 0.5)));
+    }
+    bgi::rtree<box_type, Parameters> box_rtree(boxes, parameters);
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        std::vector<box_type> found;
+        box_rtree.query(bgi::nearest(queries[i], 5), std::back_inserter(found));
+        BOOST_CHECK_EQUAL(found.size(), 5u);
+        std::vector<double> const expected = distances(queries[i], boxes);
+        std::vector<double> const detected = distances(queries[i], found);
+        for (std::size_t j = 0; j < 5 && j < detected.size(); j++)
+        {
+            BOOST_CHECK_CLOSE(detected[j], expected[j], 0.0001);
+        }
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_rtree(bgi::linear<8>());
+    test_rtree(bgi::quadratic<8>());
+    test_rtree(bgi::rstar<8>());
+
+    return 0;
+}
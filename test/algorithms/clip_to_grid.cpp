@@ -0,0 +1,174 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/clip_to_grid.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/algorithms/intersection.hpp>
+#include <boost/geometry/multi/algorithms/length.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+typedef std::pair<std::size_t, std::size_t> cell_type;
+
+// Sums the area (or length) and counts the parts per cell
+struct collector
+{
+    std::map<cell_type, double> measure;
+    std::map<cell_type, std::size_t> count;
+    bool valid;
+
+    collector()
+        : valid(true)
+    {}
+
+    template <typename Polygon>
+    inline double get(Polygon const& polygon, bg::polygon_tag)
+    {
+        valid = valid && bg::is_valid(polygon);
+        return bg::area(polygon);
+    }
+
+    template <typename Linestring>
+    inline double get(Linestring const& line, bg::linestring_tag)
+    {
+        return bg::length(line);
+    }
+
+    template <typename Geometry>
+    inline void apply(std::size_t column, std::size_t row, Geometry const& part)
+    {
+        double const m = get(part, typename bg::tag<Geometry>::type());
+        if (m > 0)
+        {
+            // Parts of only one point (touching the cell) are not counted
+            cell_type const cell(column, row);
+            measure[cell] += m;
+            count[cell]++;
+        }
+    }
+};
+
+
+// Compares clip_to_grid with the intersection of each cell
+template <typename GeometryOut, typename Geometry>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+        double x, double y, double width, double height,
+        std::size_t columns, std::size_t rows)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::regular_grid<point_type> const grid(point_type(x, y),
+        width, height, columns, rows);
+
+    collector detected;
+    bg::clip_to_grid<GeometryOut>(geometry, grid, detected);
+
+    BOOST_CHECK_MESSAGE(detected.valid, caseid << " results are not valid");
+
+    collector expected;
+    for (std::size_t c = 0; c < columns; c++)
+    {
+        for (std::size_t r = 0; r < rows; r++)
+        {
+            box_type box;
+            grid.cell(c, r, box);
+
+            std::vector<GeometryOut> parts;
+            bg::intersection(geometry, box, parts);
+            for (std::size_t i = 0; i < parts.size(); i++)
+            {
+                expected.apply(c, r, parts[i]);
+            }
+        }
+    }
+
+    for (std::map<cell_type, double>::const_iterator it = expected.measure.begin();
+         it != expected.measure.end(); ++it)
+    {
+        BOOST_CHECK_MESSAGE(detected.count[it->first] == expected.count[it->first],
+            caseid << " cell " << it->first.first << " " << it->first.second
+            << " count: " << detected.count[it->first]
+            << " expected: " << expected.count[it->first]);
+        BOOST_CHECK_CLOSE(detected.measure[it->first] + 1.0, it->second + 1.0, 0.001);
+    }
+
+    // No results outside the expected cells
+    BOOST_CHECK(detected.measure.size() <= expected.measure.size());
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    test_geometry<polygon, polygon>("square",
+        "POLYGON((1 1,1 9,9 9,9 1,1 1))", 0, 0, 2, 2, 5, 5);
+    test_geometry<polygon, polygon>("on_borders",
+        "POLYGON((2 2,2 8,8 8,8 2,2 2))", 0, 0, 2, 2, 5, 5);
+    test_geometry<polygon, polygon>("exceeding_grid",
+        "POLYGON((-3 -3,-3 13,13 13,13 -3,-3 -3))", 0, 0, 2, 2, 5, 5);
+    test_geometry<polygon, polygon>("diamond",
+        "POLYGON((5 0.5,0.5 5,5 9.5,9.5 5,5 0.5))", 0, 0, 2, 3, 5, 4);
+    test_geometry<polygon, polygon>("with_holes",
+        "POLYGON((0.5 0.5,0.5 9.5,9.5 9.5,9.5 0.5,0.5 0.5),"
+        "(2.5 2.5,3.5 2.5,3.5 3.5,2.5 3.5,2.5 2.5),(5 5,5 7,7 7,7 5,5 5))",
+        0, 0, 2, 2, 5, 5);
+    test_geometry<polygon, polygon>("u_shape",
+        "POLYGON((0.5 0.5,0.5 9.5,1.5 9.5,1.5 1.5,8.5 1.5,8.5 9.5,9.5 9.5,9.5 0.5,0.5 0.5))",
+        0, 0, 10, 5, 1, 2);
+    test_geometry<polygon_ccw_open, polygon_ccw_open>("ccw_open",
+        "POLYGON((1 1,9 1,9 9,1 9))", 0, 0, 3, 3, 3, 3);
+    test_geometry<polygon, ring>("ring",
+        "POLYGON((1 1,1 9,9 9,9 1,1 1))", 0, 0, 2, 2, 5, 5);
+    test_geometry<polygon, multi_polygon>("multi",
+        "MULTIPOLYGON(((1 1,1 4,4 4,4 1,1 1)),((5 5,5 9,9 9,5 5)))",
+        0, 0, 2, 2, 5, 5);
+
+    test_geometry<linestring, linestring>("line",
+        "LINESTRING(0.5 0.5,9.5 7.5,1 8,1 2)", 0, 0, 2, 2, 5, 5);
+    test_geometry<linestring, linestring>("line_borders",
+        "LINESTRING(0 0,4 0,4 4,10 4,10 10)", 0, 0, 2, 2, 5, 5);
+    test_geometry<linestring, linestring>("line_outside",
+        "LINESTRING(-5 -5,-5 15,5 15,5 -5,15 5)", 0, 0, 2, 2, 5, 5);
+    test_geometry<linestring, multi_linestring>("multi_line",
+        "MULTILINESTRING((0.5 0.5,9.5 9.5),(9.5 0.5,0.5 9.5))", 0, 0, 2, 2, 5, 5);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -12,6 +12,7 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <cstddef>
 #include <string>
 
@@ -21,6 +22,51 @@
 #include <boost/geometry/geometries/point_xy.hpp>
 
 
+template <typename P>
+void test_interior_points()
+{
+    // A 16-gon with many points inside and halfway its edges.
+    // Most of them are discarded before sorting, the hull should be the
+    // same as the hull of the vertices only.
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::ring<P> ring;
+
+    linestring vertices, all;
+    double const pi = 3.14159265358979323846;
+    for (int i = 0; i < 16; i++)
+    {
+        double const angle = i * pi / 8.0;
+        P p(std::floor(100.0 * std::cos(angle) + 0.5),
+            std::floor(100.0 * std::sin(angle) + 0.5));
+        bg::append(vertices, p);
+    }
+    for (int i = 0; i < 16; i++)
+    {
+        P const& p = vertices[i];
+        P const& q = vertices[(i + 1) % 16];
+        bg::append(all, p);
+        bg::append(all, P((bg::get<0>(p) + bg::get<0>(q)) / 2,
+                          (bg::get<1>(p) + bg::get<1>(q)) / 2));
+        for (int j = -60; j <= 60; j += 3)
+        {
+            bg::append(all, P(j, (i - 8) * 7));
+        }
+    }
+
+    ring expected, detected;
+    bg::convex_hull(vertices, expected);
+    bg::convex_hull(all, detected);
+
+    BOOST_CHECK_EQUAL(bg::num_points(detected), 17u);
+    BOOST_CHECK(bg::num_points(detected) == bg::num_points(expected));
+    for (std::size_t i = 0; i < expected.size() && i < detected.size(); i++)
+    {
+        BOOST_CHECK(bg::get<0>(expected[i]) == bg::get<0>(detected[i]));
+        BOOST_CHECK(bg::get<1>(expected[i]) == bg::get<1>(detected[i]));
+    }
+}
+
+
 template <typename P>
 void test_all()
 {
@@ -46,6 +92,13 @@ void test_all()
 
     test_geometry<bg::model::box<P> >("box(0 0,2 2)", 4, 5, 4);
 
+    // grid of 5x5 points, most of them inside the hull
+    test_geometry<bg::model::linestring<P> >(
+        "linestring(0 0,1 0,2 0,3 0,4 0,4 1,3 1,2 1,1 1,0 1,0 2,1 2,2 2,3 2,4 2"
+        ",4 3,3 3,2 3,1 3,0 3,0 4,1 4,2 4,3 4,4 4)", 25, 5, 16.0);
+
+    test_interior_points<P>();
+
     test_empty_input<bg::model::linestring<P> >();
     test_empty_input<bg::model::ring<P> >();
     test_empty_input<bg::model::polygon<P> >();
@@ -295,6 +295,28 @@ struct svg_visitor
 #endif
 
 
+// Stops the partitioning after the specified number of equal points
+struct stopping_point_visitor
+{
+    int count;
+    int limit;
+
+    stopping_point_visitor(int l)
+        : count(0)
+        , limit(l)
+    {}
+
+    template <typename Item>
+    inline bool apply(Item const& item1, Item const& item2)
+    {
+        if (bg::equals(item1, item2))
+        {
+            count++;
+        }
+        return count < limit;
+    }
+};
+
 template <typename Collection>
 void fill_points(Collection& collection, int seed, int size, int count)
 {
@@ -389,6 +411,44 @@ void test_many_points(int seed, int size, int count)
 #endif
 }
 
+void test_stop(int seed, int size, int count)
+{
+    bg::model::multi_point<point_item> mp1, mp2;
+
+    fill_points(mp1, seed, size, count);
+    fill_points(mp2, seed, size, count);
+
+    // Both collections are equal, so there are (many) more than 3 pairs
+    stopping_point_visitor visitor(3);
+    bg::partition
+        <
+            bg::model::box<point_item>,
+            get_point, ovelaps_point
+        >::apply(mp1, mp2, visitor, 2);
+    BOOST_CHECK_EQUAL(visitor.count, 3);
+
+    // Without partitioning (all pairs)
+    stopping_point_visitor quadratic_visitor(3);
+    bg::partition
+        <
+            bg::model::box<point_item>,
+            get_point, ovelaps_point
+        >::apply(mp1, mp2, quadratic_visitor, 1000);
+    BOOST_CHECK_EQUAL(quadratic_visitor.count, 3);
+
+    // One collection, containing each point twice
+    bg::model::multi_point<point_item> mp;
+    fill_points(mp, seed, size, count);
+    fill_points(mp, seed, size, count);
+    stopping_point_visitor single_visitor(3);
+    bg::partition
+        <
+            bg::model::box<point_item>,
+            get_point, ovelaps_point
+        >::apply(mp, single_visitor, 2);
+    BOOST_CHECK_EQUAL(single_visitor.count, 3);
+}
+
 template <typename Collection>
 void fill_boxes(Collection& collection, int seed, int size, int count)
 {
@@ -654,5 +714,7 @@ int test_main( int , char* [] )
 
     test_heterogenuous_collections(67890, 98765, 20, 60);
 
+    test_stop(12345, 20, 40);
+
     return 0;
 }
@@ -0,0 +1,219 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/distance_batch.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Points of a grid around the globe, with a few duplicates of
+// the references and vertices used below
+template <typename Point>
+std::vector<Point> create_points()
+{
+    std::vector<Point> points;
+    for (double lon = -179.5; lon <= 180.0; lon += 7.3)
+    {
+        for (double lat = -89.5; lat <= 90.0; lat += 5.9)
+        {
+            points.push_back(Point(lon, lat));
+        }
+    }
+    points.push_back(Point(4.9, 52.4));
+    points.push_back(Point(2.3, 48.9));
+    points.push_back(Point(3.6, 50.65));
+    return points;
+}
+
+// Distance calculated by the strategies, one by one. For tracks, as distance
+// does for cartesian linestrings (which it does not support for spherical)
+template <typename Point>
+double expected_distance(Point const& point, Point const& geometry,
+        bg::strategy::distance::haversine<double> const& strategy)
+{
+    return bg::distance(point, geometry, strategy);
+}
+
+template <typename Point>
+double expected_distance(Point const& point,
+        bg::model::segment<Point> const& segment,
+        bg::strategy::distance::cross_track<> const& strategy)
+{
+    return strategy.apply(point, segment.first, segment.second);
+}
+
+template <typename Point>
+double expected_distance(Point const& point,
+        bg::model::linestring<Point> const& linestring,
+        bg::strategy::distance::cross_track<> const& strategy)
+{
+    if (linestring.size() == 1)
+    {
+        return strategy.apply(point, linestring[0], linestring[0]);
+    }
+    double result = strategy.apply(point, linestring[0], linestring[1]);
+    for (std::size_t i = 2; i < linestring.size(); i++)
+    {
+        double const d = strategy.apply(point, linestring[i - 1], linestring[i]);
+        if (bg::math::equals(d, 0.0))
+        {
+            return 0.0;
+        }
+        if (d < result)
+        {
+            result = d;
+        }
+    }
+    return result;
+}
+
+// The results are the same, apart from rounding (in meters)
+inline bool same_distance(double a, double b)
+{
+    return bg::math::abs(a - b) <= 1.0e-6;
+}
+
+// Compares the batch with the strategy for all points
+template <typename Point, typename Geometry, typename Strategy>
+void test_geometry(std::string const& wkt, Strategy const& strategy)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::vector<Point> const points = create_points<Point>();
+
+    std::vector<double> result;
+    bg::distance_batch(points, geometry, result, strategy);
+    BOOST_CHECK_EQUAL(result.size(), points.size());
+
+    for (std::size_t i = 0; i < points.size() && i < result.size(); i++)
+    {
+        double const expected = expected_distance(points[i], geometry, strategy);
+        BOOST_CHECK_MESSAGE(same_distance(result[i], expected),
+            wkt << " at " << bg::wkt(points[i])
+                << " expected: " << expected << " detected: " << result[i]);
+    }
+
+    // Using the default strategy
+    std::vector<double> with_default;
+    bg::distance_batch(points, geometry, with_default);
+    BOOST_CHECK_EQUAL(with_default.size(), points.size());
+    for (std::size_t i = 0; i < points.size() && i < with_default.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(with_default[i] * strategy.radius(), result[i], 0.0001);
+    }
+}
+
+template <typename Point, typename Geometry, typename Strategy>
+void test_matrix(std::vector<std::string> const& wkts, Strategy const& strategy)
+{
+    std::vector<Geometry> geometries(wkts.size());
+    for (std::size_t j = 0; j < wkts.size(); j++)
+    {
+        bg::read_wkt(wkts[j], geometries[j]);
+    }
+
+    std::vector<Point> const points = create_points<Point>();
+    std::size_t const n = points.size();
+
+    std::vector<double> result;
+    bg::distance_matrix(points, geometries, result, strategy);
+    BOOST_CHECK_EQUAL(result.size(), n * geometries.size());
+
+    for (std::size_t j = 0; j < geometries.size(); j++)
+    {
+        for (std::size_t i = 0; i < n && j * n + i < result.size(); i++)
+        {
+            double const expected = expected_distance(points[i], geometries[j], strategy);
+            BOOST_CHECK_MESSAGE(same_distance(result[j * n + i], expected),
+                wkts[j] << " at " << bg::wkt(points[i])
+                    << " expected: " << expected
+                    << " detected: " << result[j * n + i]);
+        }
+    }
+}
+
+template <typename Point>
+void test_all()
+{
+    typedef bg::model::linestring<Point> linestring;
+    typedef bg::model::segment<Point> segment;
+
+    double const earth_radius = 6372795.0;
+    bg::strategy::distance::haversine<double> const haversine(earth_radius);
+    bg::strategy::distance::cross_track<> const cross_track(earth_radius);
+
+    test_geometry<Point, Point>("POINT(4.9 52.4)", haversine);
+    test_geometry<Point, Point>("POINT(-179 -89)", haversine);
+
+    test_geometry<Point, segment>("SEGMENT(2.3 48.9,4.9 52.4)", cross_track);
+    test_geometry<Point, linestring>("LINESTRING(2.3 48.9,3.6 50.65,4.9 52.4,13.4 52.5)", cross_track);
+    test_geometry<Point, linestring>("LINESTRING(-120 10,-60 -20,0 30,60 -40,120 0)", cross_track);
+
+    // Degenerate tracks
+    test_geometry<Point, linestring>("LINESTRING(4.9 52.4)", cross_track);
+    test_geometry<Point, linestring>("LINESTRING(4.9 52.4,4.9 52.4,13.4 52.5)", cross_track);
+
+    {
+        std::vector<std::string> wkts;
+        wkts.push_back("POINT(4.9 52.4)");
+        wkts.push_back("POINT(2.3 48.9)");
+        wkts.push_back("POINT(-73.9 40.7)");
+        test_matrix<Point, Point>(wkts, haversine);
+    }
+
+    {
+        std::vector<std::string> wkts;
+        wkts.push_back("LINESTRING(2.3 48.9,3.6 50.65,4.9 52.4)");
+        wkts.push_back("LINESTRING(-73.9 40.7,-0.1 51.5,13.4 52.5)");
+        test_matrix<Point, linestring>(wkts, cross_track);
+    }
+
+    {
+        // Empty input
+        std::vector<Point> const empty;
+        Point const p(4.9, 52.4);
+        std::vector<double> result(3);
+        bg::distance_batch(empty, p, result, haversine);
+        BOOST_CHECK_EQUAL(result.size(), 0u);
+
+        std::vector<Point> const points(2, p);
+        std::vector<linestring> const no_tracks;
+        bg::distance_matrix(points, no_tracks, result, cross_track);
+        BOOST_CHECK_EQUAL(result.size(), 0u);
+
+        // An empty track throws, as distance does
+        linestring const empty_track;
+        BOOST_CHECK_THROW(bg::distance_batch(points, empty_track, result,
+                                             cross_track),
+                          bg::empty_input_exception);
+
+        std::vector<linestring> const tracks(1, empty_track);
+        BOOST_CHECK_THROW(bg::distance_matrix(points, tracks, result,
+                                              cross_track),
+                          bg::empty_input_exception);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
+
+    return 0;
+}
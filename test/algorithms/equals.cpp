@@ -17,6 +17,7 @@
 #include <boost/geometry/geometries/point_xy.hpp>
 
 #include <boost/geometry/multi/geometries/multi_linestring.hpp>
+#include <boost/geometry/multi/geometries/multi_point.hpp>
 
 #include <boost/geometry/multi/core/topological_dimension.hpp>
 #include <boost/geometry/multi/core/point_order.hpp>
@@ -28,6 +29,28 @@
 
 namespace bgm = bg::model;
 
+template <typename P>
+void test_point_multipoint()
+{
+    typedef bgm::multi_point<P> mpt;
+
+    test_geometry<P, mpt>("pt_mpt_1", "POINT(1 1)", "MULTIPOINT((1 1))", true);
+    test_geometry<P, mpt>("pt_mpt_2", "POINT(1 1)", "MULTIPOINT((1 1),(1 1))", true);
+    test_geometry<P, mpt>("pt_mpt_3", "POINT(1 1)", "MULTIPOINT((1 1),(2 2))", false);
+    test_geometry<mpt, P>("mpt_pt_1", "MULTIPOINT((2 2))", "POINT(1 1)", false);
+}
+
+template <typename P>
+void test_multipoint_multipoint()
+{
+    typedef bgm::multi_point<P> mpt;
+
+    test_geometry<mpt, mpt>("mpt_mpt_1", "MULTIPOINT((0 0),(1 1))", "MULTIPOINT((1 1),(0 0))", true);
+    test_geometry<mpt, mpt>("mpt_mpt_2", "MULTIPOINT((0 0),(1 1))", "MULTIPOINT((1 1),(0 0),(1 1))", true);
+    test_geometry<mpt, mpt>("mpt_mpt_3", "MULTIPOINT((0 0),(1 1))", "MULTIPOINT((1 1),(0 0),(2 2))", false);
+    test_geometry<mpt, mpt>("mpt_mpt_4", "MULTIPOINT((0 0),(1 1))", "MULTIPOINT((0 0))", false);
+}
+
 template <typename P>
 void test_segment_segment()
 {
@@ -183,6 +206,8 @@ void test_all()
         "POLYGON((0 0,0 3,3 3,3 0,0 0),(1 1,2 1,2 2,1 2,1 1))",
         "POLYGON((0 0,0 3,3 3,3 0,0 0),(2 2,1 2,1 1,2 1,2 2))", true);
 
+    test_point_multipoint<P>();
+    test_multipoint_multipoint<P>();
     test_segment_segment<P>();
     test_linestring_linestring<P>();
     test_linestring_multilinestring<P>();
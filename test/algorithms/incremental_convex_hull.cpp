@@ -0,0 +1,181 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/incremental_convex_hull.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Verifies that the incremental hull is the same, point by point, as the
+// hull calculated by convex_hull from all points inserted until then
+template <typename Ring, typename Hull, typename MultiPoint>
+void check_hull(Hull const& incremental, MultiPoint const& points,
+                std::string const& caseid)
+{
+    std::size_t const closing
+        = bg::closure<Ring>::value == bg::closed ? 1 : 0;
+
+    Ring expected, detected;
+    bg::convex_hull(points, expected);
+    incremental.hull(detected);
+
+    // convex_hull of a multi-point always closes the ring
+    if (closing == 0 && expected.size() > 1)
+    {
+        expected.pop_back();
+    }
+
+    BOOST_CHECK_MESSAGE(bg::num_points(detected) == bg::num_points(expected),
+        caseid << " #points: " << bg::num_points(detected)
+        << " expected: " << bg::num_points(expected)
+        << " detected: " << bg::wkt(detected)
+        << " expected: " << bg::wkt(expected));
+
+    for (std::size_t i = 0; i < expected.size() && i < detected.size(); i++)
+    {
+        BOOST_CHECK_MESSAGE(bg::get<0>(expected[i]) == bg::get<0>(detected[i])
+                && bg::get<1>(expected[i]) == bg::get<1>(detected[i]),
+            caseid << " differs at " << i
+            << " detected: " << bg::wkt(detected)
+            << " expected: " << bg::wkt(expected));
+    }
+
+    BOOST_CHECK_EQUAL(incremental.size() + closing, bg::num_points(expected));
+}
+
+
+template <typename Ring, typename MultiPoint>
+void test_stream(MultiPoint const& input, std::string const& caseid)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+
+    bg::incremental_convex_hull<point_type> incremental;
+    MultiPoint points;
+    for (std::size_t i = 0; i < input.size(); i++)
+    {
+        incremental.insert(input[i]);
+        points.push_back(input[i]);
+        if (points.size() >= 3)
+        {
+            check_hull<Ring>(incremental, points, caseid);
+        }
+    }
+}
+
+
+template <typename Ring, typename MultiPoint>
+void test_wkt(std::string const& wkt, std::size_t expected_size,
+              std::string const& caseid)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+
+    MultiPoint input;
+    bg::read_wkt(wkt, input);
+    test_stream<Ring>(input, caseid);
+
+    bg::incremental_convex_hull<point_type> incremental;
+    incremental.insert_range(input);
+    BOOST_CHECK_EQUAL(incremental.size(), expected_size);
+}
+
+
+// Pseudo random points on a small grid, with many duplicate and
+// collinear points, and on a larger grid
+template <typename Ring, typename MultiPoint>
+void test_random(int grid, std::size_t count, std::string const& caseid)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+
+    MultiPoint input;
+    unsigned int seed = 12345;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        int const x = (seed >> 8) % grid;
+        seed = seed * 1103515245u + 12345u;
+        int const y = (seed >> 8) % grid;
+        input.push_back(point_type(x, y));
+    }
+    test_stream<Ring>(input, caseid);
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::ring<P> cw_ring;
+    typedef bg::model::ring<P, false> ccw_ring;
+    typedef bg::model::ring<P, true, false> cw_open_ring;
+    typedef bg::model::ring<P, false, false> ccw_open_ring;
+
+    test_wkt<cw_ring, mp>("multipoint((0 0),(4 0),(4 4),(0 4),(2 2))", 4, "square");
+    test_wkt<ccw_ring, mp>("multipoint((0 0),(4 0),(4 4),(0 4),(2 2))", 4, "square_ccw");
+    test_wkt<cw_open_ring, mp>("multipoint((0 0),(4 0),(4 4),(0 4),(2 2))", 4, "square_open");
+    test_wkt<ccw_open_ring, mp>("multipoint((0 0),(4 0),(4 4),(0 4),(2 2))", 4, "square_ccw_open");
+
+    // Points inserted from inside to outside, all vertices are replaced
+    test_wkt<cw_ring, mp>("multipoint((1 1),(2 1),(2 2),(0 0),(3 0),(3 3),(0 3),"
+        "(-1 -1),(4 -1),(4 4),(-1 4))", 4, "growing");
+
+    // Collinear points on edges and vertical edges are not part of the hull
+    test_wkt<cw_ring, mp>("multipoint((0 0),(0 2),(0 1),(2 0),(1 0),(2 2),(1 2),(2 1),(1 1))",
+        4, "collinear");
+
+    // Duplicates
+    test_wkt<cw_ring, mp>("multipoint((1 1),(1 1),(3 1),(3 1),(2 5),(2 5),(1 1))", 3, "duplicates");
+
+    test_random<cw_ring, mp>(8, 300, "grid8");
+    test_random<ccw_ring, mp>(8, 300, "grid8_ccw");
+    test_random<cw_open_ring, mp>(8, 300, "grid8_open");
+    test_random<cw_ring, mp>(1000, 1000, "grid1000");
+
+    // Degenerate hulls
+    {
+        bg::incremental_convex_hull<P> incremental;
+        BOOST_CHECK(incremental.empty());
+        BOOST_CHECK_EQUAL(incremental.size(), 0u);
+
+        incremental.insert(P(1, 1));
+        BOOST_CHECK_EQUAL(incremental.size(), 1u);
+        BOOST_CHECK(! incremental.insert(P(1, 1)));
+
+        incremental.insert(P(3, 3));
+        BOOST_CHECK_EQUAL(incremental.size(), 2u);
+        BOOST_CHECK(! incremental.insert(P(2, 2)));
+        BOOST_CHECK_EQUAL(incremental.size(), 2u);
+
+        BOOST_CHECK(incremental.insert(P(2, 4)));
+        BOOST_CHECK_EQUAL(incremental.size(), 3u);
+
+        incremental.clear();
+        BOOST_CHECK(incremental.empty());
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<int> >();
+
+    return 0;
+}
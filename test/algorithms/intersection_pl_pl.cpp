@@ -183,3 +183,35 @@ BOOST_AUTO_TEST_CASE( test_intersection_multipoint_multipoint )
          "mpmpi06");
 }
 
+
+
+BOOST_AUTO_TEST_CASE( test_intersection_multipoint_multipoint_integer )
+{
+#ifdef BOOST_GEOMETRY_TEST_DEBUG
+    std::cout << std::endl << std::endl << std::endl;
+    std::cout << "*** MULTIPOINT / MULTIPOINT INTERSECTION (INTEGER) ***"
+              << std::endl;
+    std::cout << std::endl;
+#endif
+
+    // integer points are hashed
+    typedef bg::model::point<int,2,bg::cs::cartesian> P;
+    typedef bg::model::multi_point<P> MP;
+
+    typedef test_set_op_of_pointlike_geometries
+        <
+            MP, MP, MP, bg::overlay_intersection
+        > tester;
+
+    tester::apply
+        (from_wkt<MP>("MULTIPOINT(2 2,3 3,0 0,0 0,2 2,1 1,1 1,1 0,1 0)"),
+         from_wkt<MP>("MULTIPOINT(1 0,1 1,1 1,4 4)"),
+         from_wkt<MP>("MULTIPOINT(1 0,1 1,1 1)"),
+         "mpmpii01");
+
+    tester::apply
+        (from_wkt<MP>("MULTIPOINT(0 0,-1 1,1 -1)"),
+         from_wkt<MP>("MULTIPOINT(1 1,-1 1,-1 -1)"),
+         from_wkt<MP>("MULTIPOINT(-1 1)"),
+         "mpmpii02");
+}
@@ -15,6 +15,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range.hpp>
@@ -47,6 +48,7 @@
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/num_points.hpp>
 #include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/is_valid_batch.hpp>
 
 #include <boost/geometry/algorithms/detail/check_iterator_range.hpp>
 
@@ -984,3 +986,82 @@ BOOST_AUTO_TEST_CASE( test_is_valid_variant )
     vg = invalid_polygon;
     test::apply(vg, false);
 }
+
+BOOST_AUTO_TEST_CASE( test_is_valid_many_holes )
+{
+#ifdef BOOST_GEOMETRY_TEST_DEBUG
+    std::cout << std::endl << std::endl;
+    std::cout << "************************************" << std::endl;
+    std::cout << " is_valid: polygons with many holes" << std::endl;
+    std::cout << "************************************" << std::endl;
+#endif
+
+    typedef bg::model::polygon<point_type> polygon_type; // cw, closed
+    typedef test_valid<default_validity_tester, polygon_type> test;
+
+    // a grid of holes
+    std::ostringstream out;
+    out << "POLYGON((0 0,0 100,100 100,100 0,0 0)";
+    for (int x = 0; x < 10; x++)
+    {
+        for (int y = 0; y < 10; y++)
+        {
+            int const x0 = x * 10 + 2;
+            int const y0 = y * 10 + 2;
+            out << ",(" << x0 << " " << y0 << "," << x0 + 6 << " " << y0
+                << "," << x0 + 6 << " " << y0 + 6 << "," << x0 << " " << y0 + 6
+                << "," << x0 << " " << y0 << ")";
+        }
+    }
+    std::string const holes = out.str();
+
+    test::apply(from_wkt<polygon_type>(holes + ")"), true);
+    // one hole inside another one
+    test::apply(from_wkt<polygon_type>(holes + ",(53 53,55 53,55 55,53 55,53 53))"), false);
+    // one hole outside the exterior ring
+    test::apply(from_wkt<polygon_type>(holes + ",(101 1,102 1,102 2,101 2,101 1))"), false);
+}
+
+BOOST_AUTO_TEST_CASE( test_is_valid_batch )
+{
+#ifdef BOOST_GEOMETRY_TEST_DEBUG
+    std::cout << std::endl << std::endl;
+    std::cout << "************************************" << std::endl;
+    std::cout << " is_valid: batch of polygons" << std::endl;
+    std::cout << "************************************" << std::endl;
+#endif
+
+    typedef bg::model::polygon<point_type> polygon_type; // cw, closed
+
+    std::vector<polygon_type> polygons;
+    polygons.push_back(from_wkt<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2))"));
+    polygons.push_back(from_wkt<polygon_type>("POLYGON((0 0,1 1,1 0))"));
+    polygons.push_back(from_wkt<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(12 2,14 2,14 4,12 4,12 2))"));
+    polygons.push_back(from_wkt<polygon_type>("POLYGON((0 0,1 1,1 0,0 0))"));
+    polygons.push_back(from_wkt<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2),(3 3,5 3,5 5,3 5,3 3))"));
+
+    std::vector<bool> results;
+    std::size_t const invalid_count = bg::is_valid_batch(polygons, results);
+
+    BOOST_CHECK_EQUAL(results.size(), polygons.size());
+    std::size_t expected_invalid_count = 0;
+    for (std::size_t i = 0; i < polygons.size() && i < results.size(); i++)
+    {
+        bool const expected = bg::is_valid(polygons[i]);
+        BOOST_CHECK_EQUAL(results[i], expected);
+        if (! expected)
+        {
+            expected_invalid_count++;
+        }
+    }
+    BOOST_CHECK_EQUAL(invalid_count, expected_invalid_count);
+    BOOST_CHECK_EQUAL(invalid_count, 3u);
+
+    // Checking a block leaves the other results unchanged
+    std::vector<char> block_results(polygons.size(), 2);
+    BOOST_CHECK_EQUAL(bg::is_valid_batch(polygons, 1, 3, block_results), 2u);
+    BOOST_CHECK_EQUAL(block_results[0], 2);
+    BOOST_CHECK_EQUAL(block_results[1], 0);
+    BOOST_CHECK_EQUAL(block_results[2], 0);
+    BOOST_CHECK_EQUAL(block_results[3], 2);
+}
@@ -0,0 +1,157 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/algorithms/intersection.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <algorithms/test_overlay.hpp>
+
+
+// Checks if the fast clipper is used (or not), and compares the result
+// of intersection (possibly using the fast clipper) with the overlay
+template <typename Geometry, typename Polygon>
+void test_clip(std::string const& caseid, std::string const& wkt,
+        std::string const& wkt_box, bool expected_fast,
+        std::size_t expected_count, double expected_area)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+
+    Geometry polygon;
+    box_type box;
+    bg::read_wkt(wkt, polygon);
+    bg::read_wkt(wkt_box, box);
+
+    std::vector<Polygon> fast;
+    std::back_insert_iterator<std::vector<Polygon> > out(fast);
+    bool const is_fast = bg::detail::intersection::clip_polygon_with_box
+        <
+            Polygon, false
+        >::apply(polygon, box, out);
+    BOOST_CHECK_MESSAGE(is_fast == expected_fast,
+        caseid << " fast: " << is_fast << " expected: " << expected_fast);
+    BOOST_CHECK(is_fast || fast.empty());
+
+    std::vector<Polygon> clipped, reversed;
+    bg::intersection(polygon, box, clipped);
+    bg::intersection(box, polygon, reversed);
+
+    BOOST_CHECK_MESSAGE(clipped.size() == expected_count,
+        caseid << " count: " << clipped.size() << " expected: " << expected_count);
+    BOOST_CHECK_CLOSE(sum_area(clipped) + 1.0, expected_area + 1.0, 0.001);
+    BOOST_CHECK_CLOSE(sum_area(reversed) + 1.0, expected_area + 1.0, 0.001);
+
+    for (std::size_t i = 0; i < clipped.size(); i++)
+    {
+        BOOST_CHECK_MESSAGE(bg::is_valid(clipped[i]),
+            caseid << " result " << i << " is not valid");
+    }
+}
+
+
+template <typename P, bool Clockwise, bool Closed>
+void test_polygons()
+{
+    typedef bg::model::polygon<P, Clockwise, Closed> polygon;
+
+    std::string const square = Clockwise
+        ? "POLYGON((0 0,0 10,10 10,10 0,0 0))"
+        : "POLYGON((0 0,10 0,10 10,0 10,0 0))";
+    std::string const triangle = Clockwise
+        ? "POLYGON((0 0,5 10,10 0,0 0))"
+        : "POLYGON((0 0,10 0,5 10,0 0))";
+
+    test_clip<polygon, polygon>("partly", square, "BOX(5 5,15 15)", true, 1, 25.0);
+    test_clip<polygon, polygon>("within", square, "BOX(-1 -1,11 11)", true, 1, 100.0);
+    test_clip<polygon, polygon>("covers_box", square, "BOX(2 2,4 4)", true, 1, 4.0);
+    test_clip<polygon, polygon>("disjoint", square, "BOX(20 20,30 30)", true, 0, 0.0);
+    test_clip<polygon, polygon>("touching", square, "BOX(10 0,20 10)", true, 0, 0.0);
+    test_clip<polygon, polygon>("equal", square, "BOX(0 0,10 10)", true, 1, 100.0);
+    test_clip<polygon, polygon>("triangle", triangle, "BOX(-5 2,15 6)", true, 1, 24.0);
+    test_clip<polygon, polygon>("corner", triangle, "BOX(4 8,8 12)", true, 1, 2.0);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box_type;
+
+    test_polygons<P, true, true>();
+    test_polygons<P, false, true>();
+    test_polygons<P, true, false>();
+
+    // U shape, of which the box cuts both legs: falls back to overlay
+    test_clip<polygon, polygon>("u_shape",
+        "POLYGON((0 0,0 10,2 10,2 2,8 2,8 10,10 10,10 0,0 0))",
+        "BOX(-1 5,11 8)", false, 2, 12.0);
+
+    // U shape, of which the box contains the bottom: clipped fast
+    test_clip<polygon, polygon>("u_bottom",
+        "POLYGON((0 0,0 10,2 10,2 2,8 2,8 10,10 10,10 0,0 0))",
+        "BOX(-1 -1,11 5)", true, 1, 32.0);
+
+    // Spiral-like shape, around a corner of the box
+    test_clip<polygon, polygon>("around_corner",
+        "POLYGON((0 0,0 10,10 10,10 0,6 0,6 6,4 6,4 0,0 0))",
+        "BOX(3 3,12 12)", true, 1, 43.0);
+
+    // Interior rings
+    test_clip<polygon, polygon>("hole_inside",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))",
+        "BOX(2 2,12 12)", true, 1, 60.0);
+    test_clip<polygon, polygon>("hole_outside",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1))",
+        "BOX(3 3,12 12)", true, 1, 49.0);
+    test_clip<polygon, polygon>("hole_crossing",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))",
+        "BOX(5 -1,12 12)", false, 1, 48.0);
+
+    test_clip<ring, polygon>("ring", "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+        "BOX(5 5,15 15)", true, 1, 25.0);
+
+    // Multi-polygon, one of the polygons falls back
+    {
+        multi_polygon mp;
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 10,2 10,2 2,8 2,8 10,10 10,10 0,0 0)),"
+            "((20 0,20 10,30 10,30 0,20 0)))", mp);
+        box_type box;
+        bg::read_wkt("BOX(-1 5,25 8)", box);
+
+        std::vector<polygon> clipped;
+        bg::intersection(mp, box, clipped);
+        BOOST_CHECK_EQUAL(clipped.size(), 3u);
+        BOOST_CHECK_CLOSE(sum_area(clipped), 27.0, 0.001);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/mpl/assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/overlay_context.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/multi.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+
+#include <algorithms/test_overlay.hpp>
+#include <algorithms/overlay/overlay_cases.hpp>
+#include <multi/algorithms/overlay/multi_overlay_cases.hpp>
+
+
+template <typename Geometry, typename OutputPolygon, typename Context>
+void test_areal(std::string const& caseid,
+        std::string const& wkt1, std::string const& wkt2,
+        Context& context)
+{
+    Geometry g1, g2;
+    bg::read_wkt(wkt1, g1);
+    bg::read_wkt(wkt2, g2);
+
+    std::vector<OutputPolygon> expected, detected;
+
+    BOOST_CHECK_EQUAL(bg::intersection(g1, g2, expected),
+                      bg::intersection(g1, g2, detected, context));
+    check_equal_output(caseid, "intersection", expected, detected);
+
+    expected.clear();
+    detected.clear();
+    bg::union_(g1, g2, expected);
+    bg::union_(g1, g2, detected, context);
+    check_equal_output(caseid, "union", expected, detected);
+
+    expected.clear();
+    detected.clear();
+    bg::difference(g1, g2, expected);
+    bg::difference(g1, g2, detected, context);
+    check_equal_output(caseid, "difference", expected, detected);
+}
+
+template <typename Polygon>
+void test_reuse()
+{
+    // Many small overlays with one context, which keeps its memory
+    bg::overlay_context<Polygon> context;
+
+    Polygon tile;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", tile);
+
+    for (int i = -20; i <= 20; i++)
+    {
+        Polygon feature;
+        std::ostringstream out;
+        out << "POLYGON((" << i << " 2," << i + 5 << " 7,"
+            << i + 12 << " 2," << i << " 2))";
+        bg::read_wkt(out.str(), feature);
+
+        std::vector<Polygon> expected, detected;
+        bg::intersection(feature, tile, expected);
+        bg::intersection(feature, tile, detected, context);
+        check_equal_output("reuse", "intersection", expected, detected, false);
+    }
+
+    BOOST_CHECK(context.turns().capacity() > 0);
+    BOOST_CHECK(context.sections(0).capacity() > 0);
+    BOOST_CHECK(context.sections(1).capacity() > 0);
+
+    context.clear();
+    BOOST_CHECK_EQUAL(context.turns().capacity(), 0u);
+    BOOST_CHECK_EQUAL(context.sections(0).capacity(), 0u);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false> ccw_polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    // One context for all cases, also for other polygon types
+    // having the same point type
+    bg::overlay_context<polygon> context;
+
+    test_areal<polygon, polygon>("case_1", case_1[0], case_1[1], context);
+    test_areal<polygon, polygon>("case_2", case_2[0], case_2[1], context);
+    test_areal<polygon, polygon>("case_3", case_3[0], case_3[1], context);
+    test_areal<polygon, polygon>("case_10", case_10[0], case_10[1], context);
+    test_areal<polygon, polygon>("case_58", case_58[0], case_58[1], context);
+    test_areal<polygon, polygon>("disjoint", disjoint[0], disjoint[1], context);
+    test_areal<polygon, polygon>("identical", identical[0], identical[1], context);
+    test_areal<polygon, polygon>("intersect_holes_intersect",
+        intersect_holes_intersect[0], intersect_holes_intersect[1], context);
+    test_areal<ccw_polygon, ccw_polygon>("ccw_case_1",
+        ccw_case_1[0], ccw_case_1[1], context);
+    test_areal<multi_polygon, polygon>("case_multi_simplex",
+        case_multi_simplex[0], case_multi_simplex[1], context);
+    test_areal<multi_polygon, polygon>("case_multi_2",
+        case_multi_2[0], case_multi_2[1], context);
+
+    test_reuse<polygon>();
+}
+
+template <typename P>
+void test_no_rescale()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef typename bg::overlay_context<polygon>::context_policy_type
+        policy_type;
+
+    // The context policy behaves as no_rescale_policy, and selects its
+    // specializations as well
+    BOOST_MPL_ASSERT((boost::is_same
+        <
+            typename bg::base_robust_policy<policy_type>::type,
+            bg::detail::no_rescale_policy
+        >));
+
+    test_reuse<polygon>();
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_no_rescale<bg::model::d2::point_xy<int> >();
+
+    return 0;
+}
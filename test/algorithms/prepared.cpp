@@ -0,0 +1,178 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/prepared.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/multi.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+
+#include <algorithms/test_overlay.hpp>
+#include <algorithms/overlay/overlay_cases.hpp>
+
+
+template <typename Polygon>
+void test_areal(std::string const& caseid,
+        std::string const& wkt1, std::string const& wkt2)
+{
+    Polygon p1, p2;
+    bg::read_wkt(wkt1, p1);
+    bg::read_wkt(wkt2, p2);
+
+    // Use the envelope of the other as domain, such that the prepared data
+    // are used and not the fallback
+    typedef typename bg::point_type<Polygon>::type point_type;
+    bg::model::box<point_type> const box1 = bg::return_envelope<bg::model::box<point_type> >(p1);
+    bg::model::box<point_type> const box2 = bg::return_envelope<bg::model::box<point_type> >(p2);
+
+    bg::prepared_geometry<Polygon> const prepared1(p1, box2);
+    bg::prepared_geometry<Polygon> const prepared2(p2, box1);
+
+    std::vector<Polygon> expected, detected;
+
+    // Intersection, both orders
+    bg::intersection(p1, p2, expected);
+    bg::intersection(prepared1, p2, detected);
+    check_equal_output(caseid, "intersection", expected, detected);
+
+    detected.clear();
+    bg::intersection(p1, prepared2, detected);
+    check_equal_output(caseid, "intersection", expected, detected, false);
+
+    // Union
+    expected.clear();
+    detected.clear();
+    bg::union_(p1, p2, expected);
+    bg::union_(prepared1, p2, detected);
+    check_equal_output(caseid, "union", expected, detected);
+
+    // Difference, where the prepared geometry is reversed in the second case
+    expected.clear();
+    detected.clear();
+    bg::difference(p1, p2, expected);
+    bg::difference(prepared1, p2, detected);
+    check_equal_output(caseid, "difference", expected, detected, false);
+
+    detected.clear();
+    bg::difference(p1, prepared2, detected);
+    check_equal_output(caseid, "difference", expected, detected, false);
+
+    // Predicates
+    bool const intersects = bg::intersects(p1, p2);
+    BOOST_CHECK_MESSAGE(bg::intersects(prepared1, p2) == intersects,
+        "intersects " << caseid << " expected: " << intersects);
+    BOOST_CHECK_EQUAL(bg::intersects(p1, prepared2), intersects);
+    BOOST_CHECK_EQUAL(bg::intersects(prepared1, prepared2), intersects);
+    BOOST_CHECK_EQUAL(bg::disjoint(prepared1, p2), ! intersects);
+}
+
+template <typename Polygon, typename Linestring>
+void test_linear_areal(std::string const& wkt_polygon,
+        std::string const& wkt_linestring, bool expected)
+{
+    Polygon polygon;
+    Linestring linestring;
+    bg::read_wkt(wkt_polygon, polygon);
+    bg::read_wkt(wkt_linestring, linestring);
+
+    bg::prepared_geometry<Polygon> const prepared(polygon);
+
+    BOOST_CHECK_EQUAL(bg::intersects(prepared, linestring), expected);
+    BOOST_CHECK_EQUAL(bg::intersects(linestring, prepared), expected);
+}
+
+template <typename Polygon>
+void test_reuse()
+{
+    // One prepared geometry, many partners. The domain covers
+    // partners exceeding the envelope of the prepared geometry.
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    Polygon tile;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", tile);
+
+    bg::model::box<point_type> domain;
+    bg::read_wkt("POLYGON((-100 -100,100 100))", domain);
+    bg::prepared_geometry<Polygon> const prepared(tile, domain);
+
+    for (int i = -20; i <= 20; i++)
+    {
+        Polygon feature;
+        std::ostringstream out;
+        out << "POLYGON((" << i << " 2," << i + 5 << " 7,"
+            << i + 12 << " 2," << i << " 2))";
+        bg::read_wkt(out.str(), feature);
+
+        std::vector<Polygon> expected, detected;
+        bg::intersection(feature, tile, expected);
+        bg::intersection(feature, prepared, detected);
+        check_equal_output("reuse", "intersection", expected, detected, false);
+        BOOST_CHECK_EQUAL(bg::intersects(feature, prepared),
+            bg::intersects(feature, tile));
+    }
+
+    // Outside domain: falls back to the normal process
+    Polygon far_away;
+    bg::read_wkt("POLYGON((500 0,500 1000,1000 1000,500 0))", far_away);
+    std::vector<Polygon> output;
+    bg::intersection(prepared, far_away, output);
+    BOOST_CHECK(output.empty());
+    BOOST_CHECK(! bg::intersects(prepared, far_away));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false> ccw_polygon;
+    typedef bg::model::linestring<P> linestring;
+
+    test_areal<polygon>("case_1", case_1[0], case_1[1]);
+    test_areal<polygon>("case_2", case_2[0], case_2[1]);
+    test_areal<polygon>("case_3", case_3[0], case_3[1]);
+    test_areal<polygon>("case_4", case_4[0], case_4[1]);
+    test_areal<polygon>("case_5", case_5[0], case_5[1]);
+    test_areal<polygon>("case_10", case_10[0], case_10[1]);
+    test_areal<polygon>("case_21", case_21[0], case_21[1]);
+    test_areal<polygon>("case_38", case_38[0], case_38[1]);
+    test_areal<polygon>("case_58", case_58[0], case_58[1]);
+    test_areal<polygon>("disjoint", disjoint[0], disjoint[1]);
+    test_areal<polygon>("identical", identical[0], identical[1]);
+    test_areal<polygon>("first_within_second",
+        first_within_second[0], first_within_second[1]);
+    test_areal<polygon>("first_within_hole_of_second",
+        first_within_hole_of_second[0], first_within_hole_of_second[1]);
+    test_areal<polygon>("intersect_holes_intersect",
+        intersect_holes_intersect[0], intersect_holes_intersect[1]);
+    test_areal<polygon>("winded", winded[0], winded[1]);
+    test_areal<ccw_polygon>("ccw_case_1", ccw_case_1[0], ccw_case_1[1]);
+    test_areal<ccw_polygon>("ccw_case_9", ccw_case_9[0], ccw_case_9[1]);
+
+    test_linear_areal<polygon, linestring>(case_1[0], "LINESTRING(0 0,10 10)", true);
+    test_linear_areal<polygon, linestring>(case_1[0], "LINESTRING(1 2.5,1.5 2.75)", true);
+    test_linear_areal<polygon, linestring>(case_1[0], "LINESTRING(5 0,6 1)", false);
+
+    test_reuse<polygon>();
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/prepared_polygon.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/algorithms/covered_by.hpp>
+#include <boost/geometry/multi/algorithms/within.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+
+
+// Compares the prepared polygon with within/covered_by for all points
+// of a grid, which includes the vertices and many points on the segments
+template <typename Geometry>
+void test_geometry(std::string const& wkt, double step = 0.5)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::prepared_polygon<Geometry> const prepared(geometry);
+
+    bg::model::box<point_type> box;
+    bg::envelope(geometry, box);
+
+    int count_within = 0, count_covered = 0;
+    for (double x = bg::get<0, 0>(box) - 1; x <= bg::get<1, 0>(box) + 1; x += step)
+    {
+        for (double y = bg::get<0, 1>(box) - 1; y <= bg::get<1, 1>(box) + 1; y += step)
+        {
+            point_type const p(x, y);
+            bool const within = bg::within(p, geometry);
+            bool const covered_by = bg::covered_by(p, geometry);
+
+            BOOST_CHECK_MESSAGE(bg::within(p, prepared) == within,
+                "within: " << wkt << " at " << x << " " << y
+                << " expected: " << within);
+            BOOST_CHECK_MESSAGE(bg::covered_by(p, prepared) == covered_by,
+                "covered_by: " << wkt << " at " << x << " " << y
+                << " expected: " << covered_by);
+            BOOST_CHECK(bg::intersects(p, prepared) == covered_by);
+            BOOST_CHECK(bg::disjoint(p, prepared) == ! covered_by);
+
+            count_within += within ? 1 : 0;
+            count_covered += covered_by ? 1 : 0;
+        }
+    }
+
+    // Verify that the grid tests something
+    BOOST_CHECK(count_within > 0);
+    BOOST_CHECK(count_covered > count_within);
+}
+
+
+// Multi-polygon with many members: a grid of squares, each with a hole,
+// and a long polygon spanning all rows, such that many envelopes are indexed
+template <typename MultiPolygon>
+void test_many_members(int n)
+{
+    std::ostringstream out;
+    out << "MULTIPOLYGON(";
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            int const x = 3 * i;
+            int const y = 3 * j;
+            out << "((" << x << " " << y << "," << x << " " << y + 2
+                << "," << x + 2 << " " << y + 2 << "," << x + 2 << " " << y
+                << "," << x << " " << y << "),(" << x + 0.5 << " " << y + 0.5
+                << "," << x + 1 << " " << y + 0.5 << "," << x + 1 << " " << y + 1
+                << "," << x + 0.5 << " " << y + 0.5 << ")),";
+        }
+    }
+    out << "((-2 0,-2 " << 3 * n << ",-1 " << 3 * n << ",-1 0,-2 0)))";
+
+    test_geometry<MultiPolygon>(out.str(), 0.25);
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::ring<P, false, false> ccw_open_ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<ring>("POLYGON((0 0,0 5,5 5,5 0,0 0))");
+    test_geometry<ring>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_geometry<ccw_open_ring>("POLYGON((0 0,5 0,5 5,0 5))");
+
+    // Star, with many segments spanning the same bands
+    test_geometry<polygon>("POLYGON((4 0,3.5 4,0 4.5,3.5 5,4 9,4.5 5,8 4.5,4.5 4,4 0))", 0.25);
+
+    // Comb, many segments on the same level
+    test_geometry<polygon>("POLYGON((0 0,0 4,1 4,1 1,2 1,2 4,3 4,3 1,4 1,4 4,5 4,5 1,6 1,6 4,7 4,7 0,0 0))");
+
+    // With holes
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2),(6 6,8 6,8 8,6 8,6 6))");
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(5 0,8 5,5 8,2 5,5 0))");
+
+    test_geometry<multi_polygon>("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1)),((2 2,2 3,3 3,3 2,2 2)),((5 0,5 4,9 4,5 0)))");
+
+    test_many_members<multi_polygon>(12);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    return 0;
+}
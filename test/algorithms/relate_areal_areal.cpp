@@ -302,12 +302,61 @@ void test_multi_polygon_multi_polygon()
                                 "212FF1FF2");
 }
 
+template <typename P>
+void test_disjoint_envelopes()
+{
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    test_geometry<poly, poly>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+                              "POLYGON((20 0,20 10,30 10,30 0,20 0))",
+                              "FF2FF1212");
+    test_geometry<mpoly, poly>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((0 20,0 30,10 30,10 20,0 20)))",
+                               "POLYGON((20 0,20 10,30 10,30 0,20 0))",
+                               "FF2FF1212");
+    // envelopes touching
+    test_geometry<poly, poly>("POLYGON((0 0,0 10,10 10,10 0,0 0))",
+                              "POLYGON((10 10,10 20,20 20,20 10,10 10))",
+                              "FF2F01212");
+}
+
+template <typename P>
+void test_static_masks()
+{
+    typedef bg::model::polygon<P> poly;
+
+    poly p1, p2, p3;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", p1);
+    bg::read_wkt("POLYGON((5 5,5 15,15 15,15 5,5 5))", p2);
+    bg::read_wkt("POLYGON((2 2,2 8,8 8,8 2,2 2))", p3);
+
+    // consisting of 'T' and '*' only, decided as soon as it is fulfilled
+    typedef bgdr::static_mask<'T','*','T','*','*','*','T','*','*'> overlaps_mask;
+    BOOST_CHECK(bgdr::relate(p1, p2, overlaps_mask()));
+    BOOST_CHECK(! bgdr::relate(p1, p3, overlaps_mask()));
+    BOOST_CHECK(! bgdr::relate(p3, p1, overlaps_mask()));
+
+    typedef bgdr::static_mask<'*','*','*','*','*','*','*','*','*'> any_mask;
+    BOOST_CHECK(bgdr::relate(p1, p2, any_mask()));
+
+    typedef bgdr::static_mask_handler<overlaps_mask, true> handler_type;
+    handler_type handler((overlaps_mask()));
+    bgdr::set<bgdr::interior, bgdr::interior, '2'>(handler);
+    bgdr::set<bgdr::interior, bgdr::exterior, '2'>(handler);
+    BOOST_CHECK(! handler.interrupt);
+    bgdr::set<bgdr::exterior, bgdr::interior, '2'>(handler);
+    BOOST_CHECK(handler.interrupt);
+    BOOST_CHECK(handler.result());
+}
+
 template <typename P>
 void test_all()
 {
     test_polygon_polygon<P>();
     test_polygon_multi_polygon<P>();
     test_multi_polygon_multi_polygon<P>();
+    test_disjoint_envelopes<P>();
+    test_static_masks<P>();
 }
 
 int test_main( int , char* [] )
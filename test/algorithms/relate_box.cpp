@@ -0,0 +1,240 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithms/test_relate.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/crosses.hpp>
+#include <boost/geometry/algorithms/overlaps.hpp>
+#include <boost/geometry/algorithms/touches.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+template <typename P>
+void test_point_box()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::multi_point<P> mpt;
+
+    test_geometry<P, box>("POINT(1 1)", "BOX(0 0,2 2)", "0FFFFF212");
+    test_geometry<P, box>("POINT(0 1)", "BOX(0 0,2 2)", "F0FFFF212");
+    test_geometry<P, box>("POINT(2 2)", "BOX(0 0,2 2)", "F0FFFF212");
+    test_geometry<P, box>("POINT(3 1)", "BOX(0 0,2 2)", "FF0FFF212");
+
+    test_geometry<mpt, box>("MULTIPOINT(1 1,0 1,3 1)", "BOX(0 0,2 2)", "000FFF212");
+    test_geometry<mpt, box>("MULTIPOINT(1 1,0 1)", "BOX(0 0,2 2)", "00FFFF212");
+    test_geometry<mpt, box>("MULTIPOINT(3 1,4 1)", "BOX(0 0,2 2)", "FF0FFF212");
+}
+
+template <typename P>
+void test_box_box()
+{
+    typedef bg::model::box<P> box;
+
+    // disjoint
+    test_geometry<box, box>("BOX(0 0,2 2)", "BOX(3 0,5 2)", "FF2FF1212");
+    // equal
+    test_geometry<box, box>("BOX(0 0,2 2)", "BOX(0 0,2 2)", "2FFF1FFF2");
+    // touching edges, partly and completely
+    test_geometry<box, box>("BOX(0 0,2 2)", "BOX(2 1,4 3)", "FF2F11212");
+    test_geometry<box, box>("BOX(0 0,2 2)", "BOX(2 0,4 2)", "FF2F11212");
+    // touching corners
+    test_geometry<box, box>("BOX(0 0,2 2)", "BOX(2 2,4 4)", "FF2F01212");
+    // overlapping
+    test_geometry<box, box>("BOX(0 0,2 2)", "BOX(1 1,3 3)", "212101212");
+    test_geometry<box, box>("BOX(0 0,2 2)", "BOX(1 0,3 2)", "212111212");
+    // crossing
+    test_geometry<box, box>("BOX(0 1,4 2)", "BOX(1 0,2 3)", "212101212");
+    // within, touching the boundary or not
+    test_geometry<box, box>("BOX(1 1,2 2)", "BOX(0 0,3 3)", "2FF1FF212");
+    test_geometry<box, box>("BOX(0 1,2 2)", "BOX(0 0,3 3)", "2FF11F212");
+    test_geometry<box, box>("BOX(0 0,3 3)", "BOX(0 0,1 3)", "212F11FF2");
+}
+
+template <typename P>
+void test_linear_box()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::multi_linestring<ls> mls;
+
+    // disjoint
+    test_geometry<ls, box>("LINESTRING(3 0,3 2)", "BOX(0 0,2 2)", "FF1FF0212");
+    // within
+    test_geometry<ls, box>("LINESTRING(1 1,2 3)", "BOX(0 0,4 4)", "1FF0FF212");
+    // crossing
+    test_geometry<ls, box>("LINESTRING(-1 1,3 1)", "BOX(0 0,2 2)", "101FF0212");
+    test_geometry<ls, box>("LINESTRING(-1 1,1 1)", "BOX(0 0,2 2)", "1010F0212");
+    // through a corner
+    test_geometry<ls, box>("LINESTRING(-1 1,1 -1)", "BOX(0 0,2 2)", "F01FF0212");
+    test_geometry<ls, box>("LINESTRING(-1 -1,3 3)", "BOX(0 0,2 2)", "101FF0212");
+    // ending on the boundary
+    test_geometry<ls, box>("LINESTRING(-1 1,0 1)", "BOX(0 0,2 2)", "FF1F00212");
+    test_geometry<ls, box>("LINESTRING(1 1,2 1)", "BOX(0 0,2 2)", "1FF00F212");
+    // along the boundary
+    test_geometry<ls, box>("LINESTRING(0 0,0 2)", "BOX(0 0,2 2)", "F1FF0F212");
+    test_geometry<ls, box>("LINESTRING(0 -1,0 3)", "BOX(0 0,2 2)", "F11FF0212");
+    test_geometry<ls, box>("LINESTRING(1 0,2 0,2 2,0 2)", "BOX(0 0,2 2)", "F1FF0F212");
+    // the whole boundary
+    test_geometry<ls, box>("LINESTRING(0 0,0 2,2 2,2 0,0 0)", "BOX(0 0,2 2)", "F1FFFF2F2");
+    test_geometry<mls, box>("MULTILINESTRING((0 0,0 2,2 2),(2 2,2 0,0 0))", "BOX(0 0,2 2)", "F1FFFF2F2");
+    test_geometry<mls, box>("MULTILINESTRING((0 0,0 2,2 2),(1 1,3 1))", "BOX(0 0,2 2)", "111000212");
+}
+
+template <typename P>
+void test_areal_box()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    // disjoint envelopes
+    test_geometry<poly, box>("POLYGON((3 0,3 2,5 2,5 0,3 0))", "BOX(0 0,2 2)", "FF2FF1212");
+    // envelope within the interior, with a hole
+    test_geometry<poly, box>("POLYGON((1 1,1 9,9 9,9 1,1 1),(3 3,7 3,7 7,3 7,3 3))", "BOX(0 0,10 10)", "2FF1FF212");
+    // touching, overlapping, containing
+    test_geometry<poly, box>("POLYGON((2 0,2 2,4 2,4 0,2 0))", "BOX(0 0,2 2)", "FF2F11212");
+    test_geometry<poly, box>("POLYGON((1 1,1 3,3 3,3 1,1 1))", "BOX(0 0,2 2)", "212101212");
+    test_geometry<poly, box>("POLYGON((0 0,0 10,10 10,10 0,0 0))", "BOX(1 1,2 2)", "212FF1FF2");
+    test_geometry<mpoly, box>("MULTIPOLYGON(((3 0,3 2,5 2,5 0,3 0)),((1 1,1 3,3 3,3 1,1 1)))", "BOX(0 0,2 2)", "212101212");
+}
+
+template <typename Geometry>
+Geometry const& as_polygon(Geometry const& geometry)
+{
+    return geometry;
+}
+
+template <typename P>
+bg::model::polygon<P> as_polygon(bg::model::box<P> const& box)
+{
+    bg::model::polygon<P> poly;
+    bg::convert(box, poly);
+    return poly;
+}
+
+// The results should be the same as for the boxes converted to polygons,
+// which are related without the box specific code
+template <typename Geometry, typename Box>
+void check_as_polygon(Geometry const& geometry, Box const& box)
+{
+    std::string const expected = bgdr::relate<bgdr::matrix9>(
+        as_polygon(geometry), as_polygon(box));
+    std::string const detected = bgdr::relate<bgdr::matrix9>(geometry, box);
+    BOOST_CHECK_MESSAGE(expected == detected,
+        "relate: " << bg::wkt(geometry) << " and " << bg::wkt(box)
+        << " -> Expected: " << expected
+        << " detected: " << detected);
+}
+
+template <typename P>
+void test_box_as_polygon()
+{
+    typedef bg::model::box<P> box;
+
+    box const reference(P(2, 2), P(4, 4));
+
+    for (int x1 = 0; x1 <= 6; x1++)
+    {
+        for (int y1 = 0; y1 <= 6; y1++)
+        {
+            for (int x2 = x1 + 1; x2 <= 6; x2++)
+            {
+                for (int y2 = y1 + 1; y2 <= 6; y2++)
+                {
+                    check_as_polygon(box(P(x1, y1), P(x2, y2)), reference);
+                }
+            }
+        }
+    }
+}
+
+// The edges of the box are not on the grid, such that segments are not
+// collinear with them (covered by test_linear_box)
+template <typename P>
+void test_linear_as_polygon()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::linestring<P> ls;
+
+    box const reference(P(1.5, 1.5), P(4.5, 4.5));
+
+    for (int x1 = 0; x1 <= 6; x1++)
+    {
+        for (int y1 = 0; y1 <= 6; y1++)
+        {
+            for (int x2 = 0; x2 <= 6; x2++)
+            {
+                for (int y2 = 0; y2 <= 6; y2++)
+                {
+                    if (x1 == x2 && y1 == y2)
+                    {
+                        continue;
+                    }
+
+                    ls line;
+                    line.push_back(P(x1, y1));
+                    line.push_back(P(x2, y2));
+                    check_as_polygon(line, reference);
+                    line.push_back(P(x1, y2));
+                    check_as_polygon(line, reference);
+                }
+            }
+        }
+    }
+}
+
+template <typename P>
+void test_predicates()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::polygon<P> poly;
+
+    box b;
+    ls line;
+    poly polygon;
+    bg::read_wkt("BOX(0 0,2 2)", b);
+
+    bg::read_wkt("LINESTRING(-1 1,3 1)", line);
+    BOOST_CHECK(bg::crosses(line, b));
+    BOOST_CHECK(! bg::touches(line, b));
+
+    bg::read_wkt("LINESTRING(-1 1,0 1)", line);
+    BOOST_CHECK(! bg::crosses(line, b));
+    BOOST_CHECK(bg::touches(line, b));
+    BOOST_CHECK(bg::touches(b, line));
+
+    bg::read_wkt("POLYGON((1 1,1 3,3 3,3 1,1 1))", polygon);
+    BOOST_CHECK(bg::overlaps(polygon, b));
+    BOOST_CHECK(bg::overlaps(b, polygon));
+}
+
+template <typename P>
+void test_all()
+{
+    test_point_box<P>();
+    test_box_box<P>();
+    test_linear_box<P>();
+    test_areal_box<P>();
+    test_box_as_polygon<P>();
+    test_predicates<P>();
+}
+
+int test_main( int , char* [] )
+{
+    test_all<bg::model::d2::point_xy<int> >();
+    test_all<bg::model::d2::point_xy<double> >();
+
+    test_linear_as_polygon<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
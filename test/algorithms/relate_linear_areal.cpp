@@ -315,9 +315,28 @@ void test_multi_linestring_multi_polygon()
                               "11FF0F212");
 }
 
+template <typename P>
+void test_disjoint_envelopes()
+{
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::multi_linestring<ls> mls;
+    typedef bg::model::polygon<P> poly;
+
+    test_geometry<ls, poly>("LINESTRING(20 0,30 10)",
+                            "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+                            "FF1FF0212");
+    test_geometry<ls, poly>("LINESTRING(20 0,30 10,20 10,20 0)",
+                            "POLYGON((0 0,0 10,10 10,10 0,0 0))",
+                            "FF1FFF212");
+    test_geometry<mls, poly>("MULTILINESTRING((20 0,30 10),(20 20,30 30))",
+                             "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+                             "FF1FF0212");
+}
+
 template <typename P>
 void test_all()
 {
+    test_disjoint_envelopes<P>();
     test_linestring_polygon<P>();
     test_linestring_multi_polygon<P>();
     test_multi_linestring_multi_polygon<P>();
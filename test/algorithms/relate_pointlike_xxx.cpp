@@ -13,6 +13,11 @@
 
 #include <algorithms/test_relate.hpp>
 
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_set.hpp>
+#include <boost/geometry/multi/algorithms/append.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
 //TEST
 //#include <to_svg.hpp>
 
@@ -80,6 +85,109 @@ void test_point_multilinestring()
     test_geometry<P, mls>("POINT(1 0)", "MULTILINESTRING((0 0,5 0),(0 0,0 5,5 0),(0 0,-5 0),(0 0,0 -5,-5 0))", "0FFFFF1F2");
 }
 
+template <typename P>
+void test_multipoint_linear()
+{
+    typedef bg::model::multi_point<P> mpt;
+    typedef bg::model::linestring<P> ls;
+    typedef bg::model::multi_linestring<ls> mls;
+
+    test_geometry<mpt, ls>("MULTIPOINT(0 0, 1 1)", "LINESTRING(0 0, 2 2, 3 2)", "00FFFF102");
+    test_geometry<mpt, ls>("MULTIPOINT(0 0, 3 2)", "LINESTRING(0 0, 2 2, 3 2)", "F0FFFF1F2");
+    test_geometry<mpt, ls>("MULTIPOINT(1 0, 1 1)", "LINESTRING(0 0, 2 2, 3 2)", "0F0FFF102");
+    test_geometry<mpt, ls>("MULTIPOINT(5 5)", "LINESTRING(0 0, 2 2, 3 2)", "FF0FFF102");
+    test_geometry<mpt, ls>("MULTIPOINT(0 0, 1 1)", "LINESTRING(0 0, 2 2, 3 2, 0 0)", "0FFFFF1F2");
+
+    test_geometry<mpt, mls>("MULTIPOINT(0 0, 2 2)", "MULTILINESTRING((0 0, 2 0),(2 0, 2 2))", "F0FFFF1F2");
+    test_geometry<mpt, mls>("MULTIPOINT(2 0)", "MULTILINESTRING((0 0, 2 0),(2 0, 2 2))", "0FFFFF102");
+    test_geometry<mpt, mls>("MULTIPOINT(0 0, 5 5)", "MULTILINESTRING((0 0, 2 0),(2 0, 2 2))", "F00FFF102");
+}
+
+template <typename P>
+void test_multipoint_areal()
+{
+    typedef bg::model::multi_point<P> mpt;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    test_geometry<mpt, ring>("MULTIPOINT(1 1, 0 5)", "POLYGON((0 0,0 10,10 10,10 0,0 0))", "00FFFF212");
+
+    std::string const polygon = "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2))";
+    test_geometry<mpt, poly>("MULTIPOINT(1 1, 5 5)", polygon, "0FFFFF212");
+    test_geometry<mpt, poly>("MULTIPOINT(0 0, 3 3, 20 20)", polygon, "F00FFF212");
+    test_geometry<mpt, poly>("MULTIPOINT(2 3, 1 1)", polygon, "00FFFF212");
+    test_geometry<mpt, poly>("MULTIPOINT(3 3)", polygon, "FF0FFF212");
+
+    std::string const multi_polygon = "MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0)),((10 10,10 15,15 15,15 10,10 10)))";
+    test_geometry<mpt, mpoly>("MULTIPOINT(1 1, 12 12)", multi_polygon, "0FFFFF212");
+    test_geometry<mpt, mpoly>("MULTIPOINT(1 1, 7 7, 10 12)", multi_polygon, "000FFF212");
+    test_geometry<mpt, mpoly>("MULTIPOINT(7 7)", multi_polygon, "FF0FFF212");
+}
+
+// Classifying in a batch should give the same results as point by point
+template <typename P>
+void test_multipoint_batch()
+{
+    typedef bg::model::multi_point<P> mpt;
+    typedef bg::model::polygon<P> poly;
+    typedef bg::model::multi_polygon<poly> mpoly;
+
+    mpoly multi_polygon;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 20,10 30,20 20,20 0,10 10,0 0),(5 5,5 15,15 15,15 5,10 12,5 5)),"
+                 "((30 0,30 10,40 10,40 0,30 0)))", multi_polygon);
+
+    mpt multi_point;
+    for (int x = -2; x <= 42; x++)
+    {
+        for (int y = -2; y <= 32; y++)
+        {
+            bg::append(multi_point, P(x, y));
+        }
+    }
+
+    bg::detail::within::multi_point_in_geometry<mpt, mpoly>
+        classifier(multi_point, multi_polygon);
+    std::vector<int> const& codes = classifier.classify();
+
+    BOOST_CHECK_EQUAL(codes.size(), boost::size(multi_point));
+    for (std::size_t i = 0; i < codes.size(); i++)
+    {
+        int const expected = bg::detail::within::point_in_geometry(
+                        multi_point[i], multi_polygon);
+        BOOST_CHECK_MESSAGE(codes[i] == expected,
+            "Batch classification differs for " << bg::wkt(multi_point[i])
+            << " expected: " << expected << " detected: " << codes[i]);
+    }
+}
+
+template <typename P>
+void test_point_set()
+{
+    typedef bg::model::multi_point<P> mpt;
+
+    mpt multi_point;
+    bg::append(multi_point, P(0, 0));
+    bg::append(multi_point, P(1, 1));
+    bg::append(multi_point, P(2, 2));
+
+    // A point differing less than epsilon
+    double const eps = std::numeric_limits<double>::epsilon();
+    P const near(1.0 + eps, 1.0);
+
+    bg::detail::relate::point_set<P, P> const points(multi_point);
+    BOOST_CHECK(points.contains(P(1, 1)));
+    BOOST_CHECK(points.contains(near));
+    BOOST_CHECK(! points.contains(P(1, 2)));
+
+    // Exactly compared points are hashed, and differ from near points
+    BOOST_CHECK((bg::detail::relate::use_point_hash<P, P, true>::value));
+    bg::detail::relate::point_set<P, P, true> const exact(multi_point);
+    BOOST_CHECK(exact.contains(P(1, 1)));
+    BOOST_CHECK(! exact.contains(near));
+    BOOST_CHECK(! exact.contains(P(1, 2)));
+}
+
 template <typename P>
 void test_all()
 {
@@ -88,6 +196,9 @@ void test_all()
     test_multipoint_multipoint<P>();
     test_point_linestring<P>();
     test_point_multilinestring<P>();
+    test_multipoint_linear<P>();
+    test_multipoint_areal<P>();
+    test_multipoint_batch<P>();
 }
 
 int test_main( int , char* [] )
@@ -95,6 +206,8 @@ int test_main( int , char* [] )
     test_all<bg::model::d2::point_xy<int> >();
     test_all<bg::model::d2::point_xy<double> >();
 
+    test_point_set<bg::model::d2::point_xy<double> >();
+
 #if defined(HAVE_TTMATH)
     test_all<bg::model::d2::point_xy<ttmath_big> >();
 #endif
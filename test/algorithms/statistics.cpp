@@ -0,0 +1,112 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/statistics.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/multi.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::statistics<Geometry> detected;
+    bg::calculate_statistics(geometry, detected);
+
+    point_type centroid;
+    bg::centroid(geometry, centroid);
+    bg::model::box<point_type> envelope;
+    bg::envelope(geometry, envelope);
+
+    BOOST_CHECK_CLOSE(detected.area, bg::area(geometry), 0.0001);
+    BOOST_CHECK_CLOSE(detected.perimeter, bg::perimeter(geometry), 0.0001);
+    BOOST_CHECK_CLOSE(bg::get<0>(detected.centroid), bg::get<0>(centroid), 0.0001);
+    BOOST_CHECK_CLOSE(bg::get<1>(detected.centroid), bg::get<1>(centroid), 0.0001);
+    BOOST_CHECK(bg::equals(detected.envelope, envelope));
+
+    // Only the selected statistics are calculated
+    bg::statistics<Geometry> selected;
+    bg::calculate_statistics(geometry, selected,
+            bg::statistic_area | bg::statistic_envelope);
+    BOOST_CHECK_CLOSE(selected.area, bg::area(geometry), 0.0001);
+    BOOST_CHECK_EQUAL(selected.perimeter, 0);
+    BOOST_CHECK(bg::equals(selected.envelope, envelope));
+
+    bg::calculate_statistics(geometry, selected, bg::statistic_perimeter);
+    BOOST_CHECK_EQUAL(selected.area, 0);
+    BOOST_CHECK_CLOSE(selected.perimeter, bg::perimeter(geometry), 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false> ccw_polygon;
+    typedef bg::model::polygon<P, true, false> open_polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    std::string const with_hole
+        = "POLYGON((0 0,0 7,4 2,2 0,0 0),(1 1,2 1,1 2,1 1))";
+
+    test_geometry<ring>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_geometry<polygon>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_geometry<polygon>(with_hole);
+    test_geometry<ccw_polygon>("POLYGON((0 0,2 0,4 2,0 7,0 0),(1 1,1 2,2 1,1 1))");
+    test_geometry<open_polygon>("POLYGON((0 0,0 7,4 2,2 0),(1 1,2 1,1 2))");
+    test_geometry<multi_polygon>("MULTIPOLYGON(((0 0,0 7,4 2,2 0,0 0),(1 1,2 1,1 2,1 1)),((10 10,10 12,12 12,12 10,10 10)))");
+
+    {
+        // Polygon of one point: its centroid is that point
+        polygon single;
+        bg::read_wkt("POLYGON((1 2))", single);
+        bg::statistics<polygon> detected;
+        bg::calculate_statistics(single, detected);
+        BOOST_CHECK_EQUAL(detected.area, 0);
+        BOOST_CHECK_EQUAL(bg::get<0>(detected.centroid), 1);
+        BOOST_CHECK_EQUAL(bg::get<1>(detected.centroid), 2);
+    }
+
+    {
+        // Empty polygon: centroid throws, as centroid does, unless it
+        // is not selected
+        polygon empty;
+        bg::statistics<polygon> detected;
+        BOOST_CHECK_THROW(bg::calculate_statistics(empty, detected),
+                          bg::centroid_exception);
+        bg::calculate_statistics(empty, detected, bg::statistic_area);
+        BOOST_CHECK_EQUAL(detected.area, 0);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    return 0;
+}
@@ -11,6 +11,41 @@
 
 #include <string>
 
+#include <boost/range.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+
+
+// 0. Helpers to compare outputs of overlays
+
+template <typename Collection>
+inline double sum_area(Collection const& collection)
+{
+    double result = 0;
+    for (typename boost::range_iterator<Collection const>::type
+            it = boost::begin(collection); it != boost::end(collection); ++it)
+    {
+        result += bg::area(*it);
+    }
+    return result;
+}
+
+// Compares the output of an overlay with the output of the same overlay,
+// calculated in another way: the number of polygons and their total area
+template <typename Collection>
+inline void check_equal_output(std::string const& caseid,
+        std::string const& operation,
+        Collection const& expected, Collection const& detected,
+        bool check_count = true)
+{
+    BOOST_CHECK_MESSAGE(! check_count || expected.size() == detected.size(),
+        operation << " " << caseid << " count: " << detected.size()
+        << " expected: " << expected.size());
+    BOOST_CHECK_CLOSE(sum_area(expected) + 1.0, sum_area(detected) + 1.0, 0.001);
+}
+
 // 1. (Example) testcases
 static std::string example_box = "box(1.5 1.5, 4.5 2.5)";
 
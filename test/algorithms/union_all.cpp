@@ -0,0 +1,129 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/union_all.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/multi.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+
+#include <algorithms/test_overlay.hpp>
+
+
+// Adds squares of the specified size at each grid position
+template <typename Polygon>
+void add_squares(std::vector<Polygon>& polygons, int columns, int rows,
+        double size, double step)
+{
+    for (int i = 0; i < columns; i++)
+    {
+        for (int j = 0; j < rows; j++)
+        {
+            double const x = i * step, y = j * step;
+            std::ostringstream out;
+            out << "POLYGON((" << x << " " << y << "," << x << " " << y + size
+                << "," << x + size << " " << y + size << "," << x + size
+                << " " << y << "," << x << " " << y << "))";
+            Polygon polygon;
+            bg::read_wkt(out.str(), polygon);
+            polygons.push_back(polygon);
+        }
+    }
+}
+
+template <typename Geometry, typename Polygon>
+void test_one(std::string const& caseid, std::vector<Geometry> const& geometries,
+        std::size_t expected_count, double expected_area)
+{
+    bg::model::multi_polygon<Polygon> detected;
+    bg::union_all(geometries, detected);
+
+    BOOST_CHECK_MESSAGE(detected.size() == expected_count,
+        "union_all " << caseid << " expected: " << expected_count
+        << " detected: " << detected.size());
+    BOOST_CHECK_CLOSE(sum_area(detected), expected_area, 0.001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    {
+        // Overlapping squares, forming one polygon
+        std::vector<polygon> polygons;
+        add_squares(polygons, 10, 10, 2.0, 1.5);
+        test_one<polygon, polygon>("overlapping", polygons, 1, 15.5 * 15.5);
+
+        // Compare with folding union_
+        multi_polygon folded;
+        for (std::size_t i = 0; i < polygons.size(); i++)
+        {
+            multi_polygon result;
+            bg::union_(folded, polygons[i], result);
+            folded = result;
+        }
+        BOOST_CHECK_EQUAL(folded.size(), 1u);
+        BOOST_CHECK_CLOSE(sum_area(folded), 15.5 * 15.5, 0.001);
+    }
+
+    {
+        // Disjoint squares, collected without overlay
+        std::vector<polygon> polygons;
+        add_squares(polygons, 5, 4, 1.0, 2.0);
+        test_one<polygon, polygon>("disjoint", polygons, 20, 20.0);
+    }
+
+    {
+        // Squares touching at their sides, merged into one
+        std::vector<polygon> polygons;
+        add_squares(polygons, 4, 4, 1.0, 1.0);
+        test_one<polygon, polygon>("touching", polygons, 1, 16.0);
+    }
+
+    {
+        // Ring of squares, forming a polygon with a hole
+        std::vector<polygon> polygons;
+        add_squares(polygons, 3, 3, 1.0, 1.0);
+        polygons.erase(polygons.begin() + 4);
+        test_one<polygon, polygon>("ring", polygons, 1, 8.0);
+    }
+
+    {
+        // Multi-polygons as input
+        std::vector<multi_polygon> multis(2);
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((5 5,5 7,7 7,7 5,5 5)))", multis[0]);
+        bg::read_wkt("MULTIPOLYGON(((1 1,1 3,3 3,3 1,1 1)),((10 10,10 11,11 11,11 10,10 10)))", multis[1]);
+        test_one<multi_polygon, polygon>("multi", multis, 3, 7.0 + 4.0 + 1.0);
+    }
+
+    {
+        std::vector<polygon> polygons;
+        test_one<polygon, polygon>("empty", polygons, 0, 0.0);
+        add_squares(polygons, 1, 1, 1.0, 1.0);
+        test_one<polygon, polygon>("single", polygons, 1, 1.0);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/algorithms/within_batch.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/multi/algorithms/within.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+
+
+// Compares the batch with within (using the same strategy) for all points
+// of a grid, which is shifted such that no points are located on the border
+template <typename Geometry, typename Strategy>
+void test_strategy(Geometry const& geometry, std::string const& wkt,
+        Strategy const& strategy)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    bg::model::box<point_type> box;
+    bg::envelope(geometry, box);
+
+    std::vector<point_type> points;
+    for (double x = bg::get<0, 0>(box) - 1.03; x <= bg::get<1, 0>(box) + 1; x += 0.11)
+    {
+        for (double y = bg::get<0, 1>(box) - 1.07; y <= bg::get<1, 1>(box) + 1; y += 0.13)
+        {
+            points.push_back(point_type(x, y));
+        }
+    }
+
+    std::vector<bool> result;
+    bg::within_batch(points, geometry, result, strategy);
+    BOOST_CHECK_EQUAL(result.size(), points.size());
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < points.size() && i < result.size(); i++)
+    {
+        bool const expected = bg::within(points[i], geometry, strategy);
+        BOOST_CHECK_MESSAGE(result[i] == expected,
+            wkt << " at " << bg::wkt(points[i]) << " expected: " << expected);
+        count += expected ? 1 : 0;
+    }
+
+    // Verify that the grid tests something
+    BOOST_CHECK(count > 0);
+    BOOST_CHECK(count < points.size());
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    test_strategy(geometry, wkt,
+        bg::strategy::within::crossings_multiply<point_type>());
+    test_strategy(geometry, wkt,
+        bg::strategy::within::franklin<point_type>());
+
+    // Default strategy, compared with the default within
+    std::vector<point_type> points;
+    points.push_back(point_type(-1, -1));
+    points.push_back(point_type(0.5, 0.5));
+    std::vector<bool> result;
+    bg::within_batch(points, geometry, result);
+    BOOST_CHECK_EQUAL(result.size(), 2u);
+    BOOST_CHECK(! result.front());
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::ring<P, false, false> ccw_open_ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<ring>("POLYGON((0 0,0 5,5 5,5 0,0 0))");
+    test_geometry<ring>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_geometry<ccw_open_ring>("POLYGON((0 0,5 0,5 5,0 5))");
+
+    test_geometry<polygon>("POLYGON((4 0,3.5 4,0 4.5,3.5 5,4 9,4.5 5,8 4.5,4.5 4,4 0))");
+    test_geometry<polygon>("POLYGON((0 0,0 4,1 4,1 1,2 1,2 4,3 4,3 1,4 1,4 4,5 4,5 1,6 1,6 4,7 4,7 0,0 0))");
+    test_geometry<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2),(6 6,8 6,8 8,6 8,6 6))");
+
+    test_geometry<multi_polygon>("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,3 1,3 3,1 3,1 1)),((5 0,5 4,9 4,5 0)))");
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark - area_length
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares area and perimeter of rings of a million vertices, using the
+// default strategies and the blocked strategies. The blocked strategies
+// only gain if the compiler vectorizes their kernels (e.g. gcc -O3 with
+// -march=native, and -fno-math-errno for the square roots)
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <boost/timer.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/strategies/cartesian/area_surveyor_blocked.hpp>
+#include <boost/geometry/strategies/cartesian/distance_pythagoras_blocked.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename Ring>
+Ring create_ring(std::size_t count)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+
+    Ring ring;
+    double const two_pi = 2.0 * 3.14159265358979323846;
+    for (std::size_t i = 0; i <= count; i++)
+    {
+        double const angle = -two_pi * (i % count) / count;
+        double const radius = 100.0 + (i % 7);
+        bg::append(ring, point_type(100000.0 + radius * std::cos(angle),
+                    100000.0 + radius * std::sin(angle)));
+    }
+    return ring;
+}
+
+
+template <typename Ring, typename AreaStrategy, typename DistanceStrategy>
+void run(std::string const& name, Ring const& ring, int repeat,
+            AreaStrategy const& area_strategy,
+            DistanceStrategy const& distance_strategy)
+{
+    double area = 0, perimeter = 0;
+
+    boost::timer t;
+    for (int i = 0; i < repeat; i++)
+    {
+        area += bg::area(ring, area_strategy);
+    }
+    double const area_time = t.elapsed();
+
+    t.restart();
+    for (int i = 0; i < repeat; i++)
+    {
+        perimeter += bg::perimeter(ring, distance_strategy);
+    }
+    double const perimeter_time = t.elapsed();
+
+    std::cout << std::setprecision(17)
+        << name << ": area " << area / repeat << " in " << area_time << " s"
+        << ", perimeter " << perimeter / repeat
+        << " in " << perimeter_time << " s" << std::endl;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::ring<point_type> ring_type;
+
+    int const repeat = argc > 1 ? atoi(argv[1]) : 100;
+    ring_type const ring = create_ring<ring_type>(argc > 2 ? atoi(argv[2]) : 1000000);
+
+    run("default", ring, repeat,
+        bg::strategy::area::surveyor<point_type>(),
+        bg::strategy::distance::pythagoras<>());
+    run("blocked", ring, repeat,
+        bg::strategy::area::surveyor_blocked<point_type>(),
+        bg::strategy::distance::pythagoras_blocked<>());
+    run("compensated", ring, repeat,
+        bg::strategy::area::surveyor_blocked<point_type, void, true>(),
+        bg::strategy::distance::pythagoras_blocked<void, true>());
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark - distance_batch
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares calculating the distances from a million positions to a few
+// reference points and to a track, per point using the strategies and
+// using distance_matrix and distance_batch
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/distance_batch.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+namespace bg = boost::geometry;
+
+
+int main(int argc, char** argv)
+{
+    typedef bg::model::point
+        <
+            double, 2, bg::cs::spherical_equatorial<bg::degree>
+        > point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+
+    std::size_t const count = argc > 1 ? atoi(argv[1]) : 1000000;
+
+    typedef boost::minstd_rand base_generator;
+    base_generator generator(12345);
+    boost::variate_generator
+        <
+            base_generator&, boost::uniform_real<>
+        > random(generator, boost::uniform_real<>(0.0, 1.0));
+
+    std::vector<point_type> points;
+    points.reserve(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        points.push_back(point_type(random() * 20.0 - 5.0,
+                    random() * 15.0 + 40.0));
+    }
+
+    std::vector<point_type> references;
+    references.push_back(point_type(4.9, 52.4));
+    references.push_back(point_type(2.3, 48.9));
+    references.push_back(point_type(13.4, 52.5));
+    references.push_back(point_type(-0.1, 51.5));
+
+    linestring_type track;
+    for (int i = 0; i < 20; i++)
+    {
+        track.push_back(point_type(-3.0 + i * 0.8, 45.0 + (i % 3) * 0.7));
+    }
+
+    double const earth_radius = 6372795.0;
+    bg::strategy::distance::haversine<double> const haversine(earth_radius);
+    bg::strategy::distance::cross_track<> const cross_track(earth_radius);
+
+    {
+        std::vector<double> result(count * references.size());
+        boost::timer t;
+        for (std::size_t j = 0; j < references.size(); j++)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                result[j * count + i] = haversine.apply(points[i], references[j]);
+            }
+        }
+        double const per_point = t.elapsed();
+
+        std::vector<double> batch;
+        t.restart();
+        bg::distance_matrix(points, references, batch, haversine);
+        double const matrix = t.elapsed();
+
+        std::cout << "Points: per point " << per_point
+            << " s, distance_matrix " << matrix << " s" << std::endl;
+    }
+
+    {
+        std::vector<double> result(count);
+        boost::timer t;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            double d = cross_track.apply(points[i], track[0], track[1]);
+            for (std::size_t k = 2; k < track.size(); k++)
+            {
+                double const dk = cross_track.apply(points[i], track[k - 1], track[k]);
+                if (dk < d)
+                {
+                    d = dk;
+                }
+            }
+            result[i] = d;
+        }
+        double const per_point = t.elapsed();
+
+        std::vector<double> batch;
+        t.restart();
+        bg::distance_batch(points, track, batch, cross_track);
+        double const tracked = t.elapsed();
+
+        std::cout << "Track: per point " << per_point
+            << " s, distance_batch " << tracked << " s" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark - incremental_convex_hull
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the update throughput of a hull of a stream of positions,
+// maintained by incremental_convex_hull, with calculating convex_hull
+// again from all positions received. The hull is requested after every
+// interval updates.
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/timer.hpp>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/incremental_convex_hull.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+namespace bg = boost::geometry;
+
+
+// Positions of a fleet of vessels, each moving a small random step
+template <typename Point>
+std::vector<Point> create_positions(std::size_t count, std::size_t fleet)
+{
+    std::vector<Point> vessels(fleet, Point(0, 0));
+    std::vector<Point> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        Point& p = vessels[std::rand() % fleet];
+        bg::set<0>(p, bg::get<0>(p) + std::rand() % 201 - 100);
+        bg::set<1>(p, bg::get<1>(p) + std::rand() % 201 - 100);
+        result.push_back(p);
+    }
+    return result;
+}
+
+
+void report(std::string const& name, std::size_t count, std::size_t hull_size,
+            double time)
+{
+    std::cout << name << ": " << count << " updates in " << time << " s, "
+        << (time > 0 ? count / time : 0) << " updates/s, hull of "
+        << hull_size << " points" << std::endl;
+}
+
+
+int main(int argc, char** argv)
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::ring<point_type> ring_type;
+    typedef bg::model::multi_point<point_type> multi_point_type;
+
+    std::size_t const count = argc > 1 ? atoi(argv[1]) : 100000;
+    std::size_t const interval = argc > 2 ? atoi(argv[2]) : 100;
+    std::vector<point_type> const positions
+        = create_positions<point_type>(count, 1000);
+
+    {
+        boost::timer t;
+        bg::incremental_convex_hull<point_type> incremental;
+        ring_type hull;
+        for (std::size_t i = 0; i < positions.size(); i++)
+        {
+            incremental.insert(positions[i]);
+            if ((i + 1) % interval == 0)
+            {
+                incremental.hull(hull);
+            }
+        }
+        incremental.hull(hull);
+        report("incremental", count, bg::num_points(hull), t.elapsed());
+    }
+
+    {
+        boost::timer t;
+        multi_point_type received;
+        ring_type hull;
+        for (std::size_t i = 0; i < positions.size(); i++)
+        {
+            received.push_back(positions[i]);
+            if ((i + 1) % interval == 0)
+            {
+                hull.clear();
+                bg::convex_hull(received, hull);
+            }
+        }
+        hull.clear();
+        bg::convex_hull(received, hull);
+        report("convex_hull", count, bg::num_points(hull), t.elapsed());
+    }
+
+    return 0;
+}
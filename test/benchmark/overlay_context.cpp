@@ -0,0 +1,123 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark - overlay_context
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the throughput of many overlays of small polygon pairs
+// without and with an overlay context, which keeps its memory
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/overlay_context.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+namespace bg = boost::geometry;
+
+
+// Creates small random star-shaped polygons, partly overlapping each other
+template <typename Polygon>
+std::vector<Polygon> create_polygons(std::size_t polygon_count,
+            std::size_t point_count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    typedef boost::minstd_rand base_generator;
+    base_generator generator(12345);
+    boost::variate_generator
+        <
+            base_generator&, boost::uniform_real<>
+        > random(generator, boost::uniform_real<>(0.0, 1.0));
+
+    std::vector<Polygon> result(polygon_count);
+    double const two_pi = 2.0 * 3.14159265358979323846;
+    for (std::size_t i = 0; i < polygon_count; i++)
+    {
+        double const cx = random() * 10.0;
+        double const cy = random() * 10.0;
+        for (std::size_t j = 0; j < point_count; j++)
+        {
+            double const angle = -two_pi * j / point_count;
+            double const radius = 1.0 + random();
+            bg::append(result[i], point_type(cx + radius * std::cos(angle),
+                        cy + radius * std::sin(angle)));
+        }
+        bg::correct(result[i]);
+    }
+    return result;
+}
+
+
+template <typename Polygon>
+void run(std::vector<Polygon> const& polygons, int count)
+{
+    std::size_t const n = polygons.size();
+    double area1 = 0, area2 = 0;
+
+    {
+        boost::timer t;
+        std::vector<Polygon> output;
+        for (int c = 0; c < count; c++)
+        {
+            for (std::size_t i = 0; i + 1 < n; i++)
+            {
+                output.clear();
+                bg::intersection(polygons[i], polygons[i + 1], output);
+                area1 += output.empty() ? 0.0 : bg::area(output.front());
+            }
+        }
+        std::cout << "without context: " << t.elapsed() << " s" << std::endl;
+    }
+
+    {
+        boost::timer t;
+        bg::overlay_context<Polygon> context;
+        std::vector<Polygon> output;
+        for (int c = 0; c < count; c++)
+        {
+            for (std::size_t i = 0; i + 1 < n; i++)
+            {
+                output.clear();
+                bg::intersection(polygons[i], polygons[i + 1], output, context);
+                area2 += output.empty() ? 0.0 : bg::area(output.front());
+            }
+        }
+        std::cout << "with context:    " << t.elapsed() << " s" << std::endl;
+    }
+
+    // Avoid optimizing away
+    std::cout << "(areas " << area1 << " " << area2 << ")" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    int const count = argc > 1 ? std::atoi(argv[1]) : 10;
+
+    std::vector<polygon_type> const polygons
+        = create_polygons<polygon_type>(10000, 12);
+    std::cout << polygons.size() << " polygons, intersected "
+        << count << " times with their neighbour" << std::endl;
+    run(polygons, count);
+
+    return 0;
+}
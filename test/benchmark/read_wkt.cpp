@@ -0,0 +1,113 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark - read_wkt
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the throughput of reading WKT from a string (tokenizing)
+// with reading WKT from a range of characters (scanning)
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+
+namespace bg = boost::geometry;
+
+
+// Creates a multi-polygon with random coordinates, written with the
+// number of digits typical for data from databases
+std::string create_wkt(std::size_t polygon_count, std::size_t point_count)
+{
+    typedef boost::minstd_rand base_generator;
+    base_generator generator(12345);
+    boost::variate_generator
+        <
+            base_generator&, boost::uniform_real<>
+        > random(generator, boost::uniform_real<>(-180.0, 180.0));
+
+    std::ostringstream out;
+    out.precision(15);
+    out << "MULTIPOLYGON(";
+    for (std::size_t i = 0; i < polygon_count; i++)
+    {
+        out << (i > 0 ? "," : "") << "((";
+        double const x0 = random(), y0 = random() / 2.0;
+        out << x0 << " " << y0;
+        for (std::size_t j = 1; j < point_count; j++)
+        {
+            out << "," << random() << " " << random() / 2.0;
+        }
+        out << "," << x0 << " " << y0 << "))";
+    }
+    out << ")";
+    return out.str();
+}
+
+
+template <typename Geometry>
+void run(std::string const& wkt, int count)
+{
+    Geometry geometry;
+    std::size_t n = 0;
+    double const mb = count * wkt.size() / (1024.0 * 1024.0);
+
+    {
+        boost::timer t;
+        for (int i = 0; i < count; i++)
+        {
+            bg::read_wkt(wkt, geometry);
+            n += boost::size(geometry);
+        }
+        double const elapsed = t.elapsed();
+        std::cout << "tokenizing: " << elapsed << " s, "
+            << mb / elapsed << " MB/s" << std::endl;
+    }
+
+    {
+        boost::timer t;
+        for (int i = 0; i < count; i++)
+        {
+            bg::read_wkt(wkt.c_str(), wkt.c_str() + wkt.size(), geometry);
+            n += boost::size(geometry);
+        }
+        double const elapsed = t.elapsed();
+        std::cout << "scanning:   " << elapsed << " s, "
+            << mb / elapsed << " MB/s" << std::endl;
+    }
+
+    // Avoid optimizing away
+    std::cout << "(" << n << " polygons)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    int const count = argc > 1 ? std::atoi(argv[1]) : 100;
+
+    std::string const wkt = create_wkt(100, 100);
+    std::cout << "WKT of " << wkt.size() << " characters, read "
+        << count << " times" << std::endl;
+    run<multi_polygon_type>(wkt, count);
+
+    return 0;
+}
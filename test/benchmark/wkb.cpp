@@ -0,0 +1,109 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark - WKB
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares a round-trip (write and read) through WKB with one through WKT
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkb/wkb.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+#include <boost/geometry/multi/io/wkt/write.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename MultiPolygon>
+void create_multi_polygon(MultiPolygon& mp,
+        std::size_t polygon_count, std::size_t point_count)
+{
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    typedef boost::minstd_rand base_generator;
+    base_generator generator(12345);
+    boost::variate_generator
+        <
+            base_generator&, boost::uniform_real<>
+        > random(generator, boost::uniform_real<>(-180.0, 180.0));
+
+    mp.resize(polygon_count);
+    for (std::size_t i = 0; i < polygon_count; i++)
+    {
+        for (std::size_t j = 0; j < point_count; j++)
+        {
+            mp[i].outer().push_back(point_type(random(), random() / 2.0));
+        }
+        mp[i].outer().push_back(mp[i].outer().front());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    int const count = argc > 1 ? std::atoi(argv[1]) : 100;
+
+    multi_polygon_type mp, result;
+    create_multi_polygon(mp, 100, 100);
+
+    std::size_t n = 0;
+    {
+        boost::timer t;
+        for (int i = 0; i < count; i++)
+        {
+            std::ostringstream out;
+            out.precision(17);
+            out << bg::wkt(mp);
+            std::string const wkt = out.str();
+            bg::read_wkt(wkt, result);
+            n += wkt.size();
+        }
+        std::cout << "WKT: " << t.elapsed() << " s" << std::endl;
+    }
+
+    {
+        std::vector<unsigned char> wkb;
+        boost::timer t;
+        for (int i = 0; i < count; i++)
+        {
+            // The buffer is reused, like when sending messages
+            wkb.clear();
+            bg::write_wkb(mp, std::back_inserter(wkb));
+            if (! bg::read_wkb(wkb.begin(), wkb.end(), result))
+            {
+                std::cout << "Error in WKB" << std::endl;
+            }
+            n += wkb.size();
+        }
+        std::cout << "WKB: " << t.elapsed() << " s" << std::endl;
+    }
+
+    // Avoid optimizing away
+    std::cout << "(" << n << " bytes, " << boost::size(result) << " polygons)"
+        << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark - write_wkt
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the throughput of writing WKT to a stream
+// with writing WKT into a buffer of characters
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <boost/timer.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/multi/algorithms/num_points.hpp>
+#include <boost/geometry/multi/geometries/multi_polygon.hpp>
+#include <boost/geometry/multi/io/wkt/write.hpp>
+
+namespace bg = boost::geometry;
+
+
+template <typename MultiPolygon>
+void create(MultiPolygon& multi, std::size_t polygon_count,
+            std::size_t point_count)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+
+    typedef boost::minstd_rand base_generator;
+    base_generator generator(12345);
+    boost::variate_generator
+        <
+            base_generator&, boost::uniform_real<>
+        > random(generator, boost::uniform_real<>(-180.0, 180.0));
+
+    for (std::size_t i = 0; i < polygon_count; i++)
+    {
+        polygon_type polygon;
+        for (std::size_t j = 0; j < point_count; j++)
+        {
+            bg::exterior_ring(polygon).push_back(
+                point_type(random(), random() / 2.0));
+        }
+        bg::exterior_ring(polygon).push_back(bg::exterior_ring(polygon).front());
+        multi.push_back(polygon);
+    }
+}
+
+
+template <typename Geometry>
+void run(Geometry const& geometry, int count)
+{
+    std::size_t n = 0;
+
+    {
+        boost::timer t;
+        for (int i = 0; i < count; i++)
+        {
+            std::ostringstream out;
+            out.precision(17);
+            out << bg::wkt(geometry);
+            n += out.str().size();
+        }
+        std::cout << "stream: " << t.elapsed() << " s" << std::endl;
+    }
+
+    {
+        boost::timer t;
+        std::string buffer;
+        for (int i = 0; i < count; i++)
+        {
+            buffer.clear();
+            bg::write_wkt(geometry, buffer);
+            n += buffer.size();
+        }
+        std::cout << "buffer: " << t.elapsed() << " s" << std::endl;
+    }
+
+    // Avoid optimizing away
+    std::cout << "(" << n << " characters)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    int const count = argc > 1 ? std::atoi(argv[1]) : 100;
+
+    multi_polygon_type multi;
+    create(multi, 100, 100);
+    std::cout << "Multi-polygon of " << bg::num_points(multi)
+        << " points, written " << count << " times" << std::endl;
+    run(multi, count);
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/svg/svg_mapper.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+
+
+// Maps the geometry in both modes, with the same extent. Geometries without
+// vertices in the same pixel should result in the same SVG.
+template <typename Geometry>
+void test_same(std::string const& wkt)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    bg::model::box<point_type> extent(point_type(0, 0), point_type(100, 100));
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::ostringstream classic, streaming;
+    {
+        bg::svg_mapper<point_type> mapper(classic, 200, 200);
+        mapper.add(extent);
+        mapper.map(geometry, "fill:blue", 3);
+    }
+    {
+        bg::svg_mapper<point_type> mapper(streaming, 200, 200, extent);
+        mapper.map(geometry, "fill:blue", 3);
+    }
+    BOOST_CHECK_EQUAL(classic.str(), streaming.str());
+}
+
+std::size_t count(std::string const& svg, char c)
+{
+    return std::count(svg.begin(), svg.end(), c);
+}
+
+template <typename P>
+void test_streaming()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    bg::model::box<P> extent(P(0, 0), P(100, 100));
+
+    // A linestring of 10001 vertices on a map of 100 pixels wide,
+    // a linestring within one pixel, and geometries outside the extent
+    linestring dense, tiny;
+    for (int i = 0; i <= 10000; i++)
+    {
+        dense.push_back(P(i / 100.0, 50.5 + (i % 2) / 1000.0));
+        tiny.push_back(P(20.5 + (i % 7) / 1000.0, 20.5));
+    }
+
+    polygon outside;
+    bg::read_wkt("POLYGON((200 200,200 300,300 300,300 200,200 200))", outside);
+
+    std::ostringstream out;
+    {
+        bg::svg_mapper<P> mapper(out, 100, 100, extent);
+        mapper.map(dense, "stroke:red");
+        mapper.map(tiny, "stroke:green");
+        mapper.map(outside, "fill:blue");
+        mapper.map(P(-50, -50), "fill:black");
+        mapper.text(P(50, 50), "label", "font-size:10");
+    }
+
+    std::string const svg = out.str();
+    BOOST_CHECK_EQUAL(count(svg, '\n') > 0, true);
+    BOOST_CHECK(svg.find("<polyline") != std::string::npos);
+    BOOST_CHECK(svg.find("stroke:green") == std::string::npos);
+    BOOST_CHECK(svg.find("fill:blue") == std::string::npos);
+    BOOST_CHECK(svg.find("fill:black") == std::string::npos);
+
+    // At most one vertex per pixel, separated by spaces
+    std::size_t const begin = svg.find("points=\"");
+    std::size_t const end = svg.find('"', begin + 8);
+    std::string const points = svg.substr(begin, end - begin);
+    BOOST_CHECK_MESSAGE(count(points, ',') <= 101,
+        "Vertices: " << count(points, ','));
+
+    // Text is written after the mapped geometries, before closing
+    BOOST_CHECK(svg.find("<polyline") < svg.find("<text"));
+    BOOST_CHECK(svg.find("<text") < svg.find("</svg>"));
+}
+
+template <typename P>
+void test_decimate_holes()
+{
+    typedef bg::model::polygon<P> polygon;
+
+    bg::model::box<P> extent(P(0, 0), P(100, 100));
+
+    // The second hole is mapped into one pixel and is not written
+    polygon poly;
+    bg::read_wkt("POLYGON((0 0,0 100,100 100,100 0,0 0),"
+        "(10 10,20 10,20 20,10 10),"
+        "(50.1 50.1,50.2 50.1,50.2 50.2,50.1 50.1))", poly);
+
+    std::ostringstream out;
+    {
+        bg::svg_mapper<P> mapper(out, 100, 100, extent);
+        mapper.map(poly, "fill:blue");
+    }
+
+    std::string const svg = out.str();
+    BOOST_CHECK_EQUAL(count(svg, 'M'), 2u);
+}
+
+// Stream derived from std::ostream, as std::ofstream, counting its flushes
+class flush_counting_stream : public std::ostream
+{
+    struct counting_buffer : public std::stringbuf
+    {
+        counting_buffer() : flushes(0) {}
+
+        virtual int sync()
+        {
+            flushes++;
+            return std::stringbuf::sync();
+        }
+
+        int flushes;
+    };
+
+public :
+    flush_counting_stream()
+        : std::ostream(0)
+    {
+        rdbuf(&m_buffer);
+    }
+
+    inline int flushes() const { return m_buffer.flushes; }
+
+private :
+    counting_buffer m_buffer;
+};
+
+template <typename P>
+void test_flush()
+{
+    // Streams derived from std::ostream are flushed at each line
+    flush_counting_stream stream;
+    bg::svg_map(stream, "fill:blue", 3, P(10, 20),
+        bg::strategy::transform::map_transformer
+            <
+                double, 2, 2, true, false
+            >(bg::model::box<P>(P(0, 0), P(100, 100)), 200, 200));
+    BOOST_CHECK_EQUAL(stream.flushes(), 1);
+}
+
+template <typename P>
+void test_all()
+{
+    test_same<P>("POINT(10 20)");
+    test_same<bg::model::linestring<P> >("LINESTRING(0 0,50 50,100 0)");
+    test_same<bg::model::polygon<P> >(
+        "POLYGON((0 0,0 100,100 100,100 0,0 0),(10 10,20 10,20 20,10 10))");
+    test_same<bg::model::box<P> >("BOX(10 10,20 20)");
+    test_same<bg::model::multi_polygon<bg::model::polygon<P> > >(
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((50 50,50 60,60 60,50 50)))");
+
+    test_streaming<P>();
+    test_decimate_holes<P>();
+    test_flush<P>();
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
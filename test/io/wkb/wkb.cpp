@@ -0,0 +1,180 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/multi/algorithms/num_points.hpp>
+#include <boost/geometry/io/wkb/wkb.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+#include <boost/geometry/multi/io/wkt/write.hpp>
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+// Writes the geometry as WKB in both byte orders, reads it back and
+// compares the WKT. Optionally compares with hex-encoded WKB.
+template <typename Geometry>
+void test_geometry(std::string const& wkt, std::string const& expected_hex = "")
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    for (int order = 0; order < 2; order++)
+    {
+        bg::wkb_byte_order const byte_order = order == 0
+            ? bg::wkb_little_endian : bg::wkb_big_endian;
+
+        std::vector<unsigned char> wkb;
+        bg::write_wkb(geometry, std::back_inserter(wkb), byte_order);
+
+        if (order == 0 && ! expected_hex.empty())
+        {
+            std::string hex;
+            bg::wkb2hex(wkb, hex);
+            BOOST_CHECK_EQUAL(hex, expected_hex);
+        }
+
+        Geometry read_back;
+        BOOST_CHECK_MESSAGE(bg::read_wkb(wkb.begin(), wkb.end(), read_back),
+            "Cannot read WKB of " << wkt);
+        BOOST_CHECK_EQUAL(to_wkt(read_back), to_wkt(geometry));
+        BOOST_CHECK_EQUAL(bg::num_points(read_back), bg::num_points(geometry));
+
+        // Reading incomplete WKB fails
+        BOOST_CHECK(! bg::read_wkb(wkb.begin(), wkb.end() - 1, read_back));
+    }
+}
+
+template <typename Geometry>
+void test_hex(std::string const& hex, std::string const& expected_wkt,
+            bool expected = true)
+{
+    std::vector<char> wkb;
+    BOOST_CHECK(bg::hex2wkb(hex, std::back_inserter(wkb)));
+
+    Geometry geometry;
+    bool const result = bg::read_wkb(wkb.begin(), wkb.end(), geometry);
+    BOOST_CHECK_MESSAGE(result == expected, "Reading " << hex
+        << " result: " << result << " expected: " << expected);
+    if (result && expected)
+    {
+        BOOST_CHECK_EQUAL(to_wkt(geometry), expected_wkt);
+    }
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false, false> polygon_ccw_open;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box;
+    typedef bg::model::segment<P> segment;
+
+    test_geometry<P>("POINT(1 2)", "0101000000000000000000F03F0000000000000040");
+    test_geometry<linestring>("LINESTRING(1 1,2 2,3 3)");
+    test_geometry<linestring>("LINESTRING()");
+    test_geometry<ring>("POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    test_geometry<polygon>("POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1),(3 3,3.5 3,3.5 3.5,3 3))");
+    // Open rings are written closed, and read back without closing point
+    test_geometry<polygon_ccw_open>("POLYGON((0 0,4 0,4 4,0 4))",
+        "0103000000010000000500000000000000000000000000000000000000000000"
+        "0000001040000000000000000000000000000010400000000000001040000000"
+        "0000000000000000000000104000000000000000000000000000000000");
+    test_geometry<multi_point>("MULTIPOINT((1 2),(3 4))");
+    test_geometry<multi_linestring>("MULTILINESTRING((1 1,2 2),(3 3,4 4,5 5))");
+    test_geometry<multi_polygon>("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0),(1 1,2 1,2 2,1 2,1 1)),((3 3,3 4,4 4,3 3)))");
+    test_geometry<box>("BOX(1 2,3 4)");
+    test_geometry<segment>("SEGMENT(1 2,3 4)");
+
+    // Big endian
+    test_hex<P>("00000000013FF00000000000004000000000000000", "POINT(1 2)");
+    // EWKB with SRID
+    test_hex<P>("0101000020E6100000000000000000F03F0000000000000040", "POINT(1 2)");
+    // ISO point M, the M value is skipped
+    test_hex<P>("01D1070000000000000000F03F00000000000000400000000000000840", "POINT(1 2)");
+    // ISO point Z cannot be read into a 2D point
+    test_hex<P>("01E9030000000000000000F03F00000000000000400000000000000840", "", false);
+    // Multi-point with members of mixed byte order
+    test_hex<multi_point>("0104000000020000000101000000000000000000F03F0000000000000040"
+        "00000000013FF00000000000004000000000000000", "MULTIPOINT((1 2),(1 2))");
+
+    // Wrong type, wrong byte order marker
+    test_hex<linestring>("0101000000000000000000F03F0000000000000040", "", false);
+    test_hex<P>("0201000000000000000000F03F0000000000000040", "", false);
+
+    // Trailing bytes
+    test_hex<P>("0101000000000000000000F03F000000000000004000", "", false);
+
+    std::vector<char> bytes;
+    BOOST_CHECK(! bg::hex2wkb("0G", std::back_inserter(bytes)));
+    BOOST_CHECK(! bg::hex2wkb("010", std::back_inserter(bytes)));
+
+    // Concatenated WKB, read one by one
+    {
+        std::vector<char> wkb;
+        BOOST_CHECK(bg::hex2wkb("0101000000000000000000F03F0000000000000040"
+            "010100000000000000000008400000000000001040",
+            std::back_inserter(wkb)));
+
+        P p1, p2;
+        std::size_t consumed1 = 0, consumed2 = 0;
+        BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), p1, consumed1));
+        BOOST_CHECK_EQUAL(consumed1, 21u);
+        BOOST_CHECK(bg::read_wkb(wkb.begin() + consumed1, wkb.end(), p2, consumed2));
+        BOOST_CHECK_EQUAL(consumed2, 21u);
+        BOOST_CHECK_EQUAL(to_wkt(p1), "POINT(1 2)");
+        BOOST_CHECK_EQUAL(to_wkt(p2), "POINT(3 4)");
+    }
+}
+
+void test_3d()
+{
+    typedef bg::model::point<double, 3, bg::cs::cartesian> P;
+    typedef bg::model::linestring<P> linestring;
+
+    test_geometry<P>("POINT(1 2 3)",
+        "01E9030000000000000000F03F00000000000000400000000000000840");
+    test_geometry<linestring>("LINESTRING(1 2 3,4 5 6)");
+
+    // 2D is read into 3D with Z zero, and EWKB Z into 3D
+    test_hex<P>("0101000000000000000000F03F0000000000000040", "POINT(1 2 0)");
+    test_hex<P>("0101000080000000000000F03F00000000000000400000000000000840", "POINT(1 2 3)");
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+    test_3d();
+
+    return 0;
+}
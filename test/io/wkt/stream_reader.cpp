@@ -0,0 +1,197 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/stream_reader.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/multi/geometries/multi_geometries.hpp>
+#include <boost/geometry/multi/io/wkt/read.hpp>
+#include <boost/geometry/multi/io/wkt/write.hpp>
+
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Geometry>
+void check_read(bg::wkt_stream_reader& reader,
+            std::vector<std::string> const& expected,
+            std::string const& caseid)
+{
+    Geometry geometry;
+    std::size_t n = 0;
+    while (reader.read(geometry))
+    {
+        BOOST_CHECK_MESSAGE(n < expected.size()
+                && to_wkt(geometry) == expected[n],
+            caseid << " geometry " << n << ": " << to_wkt(geometry));
+        n++;
+    }
+    BOOST_CHECK_MESSAGE(n == expected.size(),
+        caseid << " count: " << n << " expected: " << expected.size());
+}
+
+// Reads the geometries from a stream, with several chunk sizes, and from
+// a range of characters
+template <typename Geometry>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+            std::string const& expected_wkt)
+{
+    std::vector<std::string> expected;
+    {
+        bg::wkt_stream_reader reader(expected_wkt.c_str(),
+                expected_wkt.c_str() + expected_wkt.size());
+        Geometry geometry;
+        while (reader.read(geometry))
+        {
+            expected.push_back(to_wkt(geometry));
+        }
+    }
+
+    bg::wkt_stream_reader reader(wkt.c_str(), wkt.c_str() + wkt.size());
+    check_read<Geometry>(reader, expected, caseid + "_range");
+
+    std::size_t const chunk_sizes[] = { 1, 3, 7, 64, 65536 };
+    for (std::size_t i = 0; i < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); i++)
+    {
+        std::istringstream in(wkt);
+        bg::wkt_stream_reader reader(in, chunk_sizes[i]);
+        check_read<Geometry>(reader, expected, caseid + "_stream");
+    }
+}
+
+template <typename Geometry>
+void test_wrong(std::string const& wkt, std::string const& start)
+{
+    std::string e("no exception");
+    std::istringstream in(wkt);
+    bg::wkt_stream_reader reader(in, 5);
+    Geometry geometry;
+    try
+    {
+        while (reader.read(geometry))
+        {}
+    }
+    catch(bg::read_wkt_exception const& ex)
+    {
+        e = ex.what();
+    }
+    BOOST_CHECK_MESSAGE(boost::starts_with(e, start),
+        "Expected: " << start << " Got: " << e << " with WKT: " << wkt);
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<P>("points",
+        "POINT(1 2)\nPOINT(3 4) point (5 6)\n",
+        "POINT(1 2) POINT(3 4) POINT(5 6)");
+    test_geometry<P>("multi_points",
+        "MULTIPOINT((1 2),(3 4)) MULTIPOINT(5 6,7 8) MULTIPOINT EMPTY POINT(9 10)",
+        "POINT(1 2) POINT(3 4) POINT(5 6) POINT(7 8) POINT(9 10)");
+    test_geometry<linestring>("linestrings",
+        "MULTILINESTRING((1 1,2 2),(3 3,4 4,5 5))\r\nLINESTRING(6 6,7 7)",
+        "LINESTRING(1 1,2 2) LINESTRING(3 3,4 4,5 5) LINESTRING(6 6,7 7)");
+    test_geometry<polygon>("polygons",
+        "MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1)),"
+        "  ((5 5,5 6,6 6,6 5,5 5)))\n"
+        "POLYGON((0 0,0 1,1 1,1 0,0 0))\n"
+        "MULTIPOLYGON EMPTY\n"
+        "POLYGON EMPTY",
+        "POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1)) "
+        "POLYGON((5 5,5 6,6 6,6 5,5 5)) POLYGON((0 0,0 1,1 1,1 0,0 0)) "
+        "POLYGON EMPTY");
+
+    // Multi-geometries can be read as a whole, too
+    {
+        std::string const wkt = "MULTIPOINT((1 2),(3 4))\tMULTIPOINT((5 6))";
+        std::istringstream in(wkt);
+        bg::wkt_stream_reader reader(in, 4);
+        multi_point mp;
+        BOOST_CHECK(reader.read(mp));
+        BOOST_CHECK_EQUAL(boost::size(mp), 2u);
+        BOOST_CHECK(reader.read(mp));
+        BOOST_CHECK_EQUAL(boost::size(mp), 1u);
+        BOOST_CHECK(! reader.read(mp));
+    }
+    {
+        std::string const wkt = "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),"
+            "((2 2,2 3,3 3,3 2,2 2)))\nMULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)))";
+        std::istringstream in(wkt);
+        bg::wkt_stream_reader reader(in, 16);
+        multi_polygon mp;
+        BOOST_CHECK(reader.read(mp));
+        BOOST_CHECK_EQUAL(boost::size(mp), 2u);
+        BOOST_CHECK(reader.read(mp));
+        BOOST_CHECK_EQUAL(boost::size(mp), 1u);
+        BOOST_CHECK(! reader.read(mp));
+    }
+
+    // A large multi-polygon, read polygon by polygon
+    {
+        std::ostringstream out;
+        out << "MULTIPOLYGON(";
+        for (int i = 0; i < 1000; i++)
+        {
+            out << (i > 0 ? "," : "") << "((" << i << " 0," << i << " 1,"
+                << i + 1 << " 1," << i + 1 << " 0," << i << " 0))";
+        }
+        out << ")";
+        std::istringstream in(out.str());
+        bg::wkt_stream_reader reader(in, 256);
+        polygon p;
+        int count = 0;
+        while (reader.read(p))
+        {
+            BOOST_CHECK_EQUAL(bg::get<0>(p.outer().front()), count);
+            count++;
+        }
+        BOOST_CHECK_EQUAL(count, 1000);
+    }
+
+    test_wrong<P>("POINT(1 2) POINT(3 4", "Expected ')'");
+    test_wrong<P>("POINT(1 2) LINESTRING(3 4)", "Should start with 'POINT'");
+    test_wrong<polygon>("MULTIPOLYGON(((0 0,0 1,1 0,0 0)),(0 0,1 1))", "Expected '('");
+    test_wrong<polygon>("MULTIPOLYGON ((0 0,0 1,1 0,0 0)", "Expected '('");
+    test_wrong<polygon>("MULTIPOLYGON Z (((0 0,0 1,1 0,0 0)))", "Z only allowed");
+
+    // Members should be separated by a comma
+    test_wrong<P>("MULTIPOINT((1 2)(3 4))", "Expected ',' or ')'");
+    test_wrong<P>("MULTIPOINT((1 2) (3 4))", "Expected ',' or ')'");
+    test_wrong<P>("MULTIPOINT((1 2),)", "Expected a member");
+    test_wrong<polygon>("MULTIPOLYGON(((0 0,0 1,1 0,0 0))((5 5,5 6,6 5,5 5)))", "Expected ',' or ')'");
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
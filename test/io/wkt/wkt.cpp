@@ -14,6 +14,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 
@@ -39,6 +40,12 @@ void check_wkt(G const& geometry, std::string const& expected)
     out << bg::wkt(geometry);
     BOOST_CHECK_EQUAL(boost::to_upper_copy(out.str()),
                       boost::to_upper_copy(expected));
+
+    // Written into a buffer, results should be the same
+    std::string buffer;
+    bg::write_wkt(geometry, buffer);
+    BOOST_CHECK_EQUAL(boost::to_upper_copy(buffer),
+                      boost::to_upper_copy(expected));
 }
 
 template <typename G>
@@ -69,6 +76,12 @@ void test_wkt(std::string const& wkt, std::size_t n, double len = 0,
 
     check_wkt(geometry, wkt);
     check_wkt(boost::variant<G>(geometry), wkt);
+
+    // Scanned from characters, results should be the same
+    G scanned;
+    bg::read_wkt(wkt.c_str(), wkt.c_str() + wkt.size(), scanned);
+    BOOST_CHECK_EQUAL(bg::num_points(scanned), n);
+    check_wkt(scanned, wkt);
 }
 
 template <typename G>
@@ -81,19 +94,31 @@ void test_relaxed_wkt(std::string const& wkt, std::string const& expected)
     out << bg::wkt(geometry);
 
     BOOST_CHECK_EQUAL(boost::to_upper_copy(out.str()), boost::to_upper_copy(expected));
+
+    G scanned;
+    bg::read_wkt(wkt.c_str(), wkt.c_str() + wkt.size(), scanned);
+    check_wkt(scanned, expected);
 }
 
 
 
 
 template <typename G>
-void test_wrong_wkt(std::string const& wkt, std::string const& start)
+void test_wrong_wkt(std::string const& wkt, std::string const& start,
+            bool scanned = false)
 {
     std::string e("no exception");
     G geometry;
     try
     {
-        bg::read_wkt(wkt, geometry);
+        if (scanned)
+        {
+            bg::read_wkt(wkt.c_str(), wkt.c_str() + wkt.size(), geometry);
+        }
+        else
+        {
+            bg::read_wkt(wkt, geometry);
+        }
     }
     catch(bg::read_wkt_exception const& ex)
     {
@@ -121,7 +146,13 @@ void test_wrong_wkt(std::string const& wkt, std::string const& start)
     if (check)
     {
         BOOST_CHECK_MESSAGE(boost::starts_with(e, start), "  Expected:"
-                    << start << " Got:" << e << " with WKT: " << wkt);
+                    << start << " Got:" << e << " with WKT: " << wkt
+                    << (scanned ? " (scanned)" : ""));
+    }
+
+    if (! scanned)
+    {
+        test_wrong_wkt<G>(wkt, start, true);
     }
 }
 
@@ -196,6 +227,61 @@ void test_all()
         || ! boost::is_fundamental<T>::type::value)
     {
         test_wkt<P>("POINT(1.1 2.1)", 1);
+
+        // Numbers converted by the fast path and by the fallback
+        std::string const numbers[] = { "0.1", "-3.25e2", "1e-7", ".5",
+            "12345678901234567890.5", "1e300", "2.2250738585072014e-308" };
+        for (std::size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++)
+        {
+            std::string const wkt = "POINT(" + numbers[i] + " 1)";
+            P expected, scanned;
+            bg::read_wkt(wkt, expected);
+            bg::read_wkt(wkt.c_str(), wkt.c_str() + wkt.size(), scanned);
+            BOOST_CHECK_MESSAGE(bg::get<0>(scanned) == bg::get<0>(expected),
+                "Scanned number differs for " << numbers[i]);
+        }
+    }
+
+    if (boost::is_same<T, double>::value)
+    {
+        // Written into a buffer, numbers are as short as possible
+        // and read back exactly
+        double const numbers[] = { 0.1, -0.5, 1e-7, 1.0 / 3.0, 123456.789,
+            -2.5e15, 1e300, 2.2250738585072014e-308, 0.0 };
+        for (std::size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++)
+        {
+            std::string buffer;
+            bg::write_wkt(P(numbers[i], 1), buffer);
+            P read_back;
+            bg::read_wkt(buffer, read_back);
+            BOOST_CHECK_MESSAGE(bg::get<0>(read_back) == numbers[i],
+                "Written number differs for " << buffer);
+        }
+
+        std::string buffer;
+        bg::write_wkt(P(0.1, -0.5), buffer);
+        BOOST_CHECK_EQUAL(buffer, "POINT(0.1 -0.5)");
+
+        // With a precision, numbers are written as by a stream
+        std::ostringstream out;
+        out.precision(3);
+        out << bg::wkt(P(1.0 / 3.0, 12345.6));
+        buffer.clear();
+        bg::write_wkt(P(1.0 / 3.0, 12345.6), buffer, 3);
+        BOOST_CHECK_EQUAL(buffer, out.str());
+
+        // Appended to a vector of characters
+        std::vector<char> chars;
+        bg::write_wkt(bg::model::linestring<P>(), chars);
+        BOOST_CHECK_EQUAL(std::string(chars.begin(), chars.end()), "LINESTRING()");
+    }
+
+    // Scanning handles tabs and newlines as spaces
+    {
+        std::string const wkt = "LINESTRING\n(1\t1,\r\n2 2)";
+        bg::model::linestring<P> ls;
+        bg::read_wkt(wkt.c_str(), wkt.c_str() + wkt.size(), ls);
+        check_wkt(ls, "LINESTRING(1 1,2 2)");
     }
 
     // Deprecated:
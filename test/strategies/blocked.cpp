@@ -0,0 +1,175 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/strategies/cartesian/area_surveyor_blocked.hpp>
+#include <boost/geometry/strategies/cartesian/distance_pythagoras_blocked.hpp>
+
+
+template <bool Compensated, typename Geometry>
+void test_areal(Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    bg::strategy::area::surveyor_blocked
+        <
+            point_type, void, Compensated
+        > area_strategy;
+    bg::strategy::distance::pythagoras_blocked<void, Compensated>
+        distance_strategy;
+
+    BOOST_CHECK_CLOSE(bg::area(geometry, area_strategy),
+                      bg::area(geometry), 0.0001);
+    BOOST_CHECK_CLOSE(bg::perimeter(geometry, distance_strategy),
+                      bg::perimeter(geometry), 0.0001);
+}
+
+template <typename Geometry>
+void test_areal(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    test_areal<false>(geometry);
+    test_areal<true>(geometry);
+}
+
+template <bool Compensated, typename Linestring>
+void test_linear(Linestring const& linestring)
+{
+    bg::strategy::distance::pythagoras_blocked<void, Compensated> strategy;
+    BOOST_CHECK_CLOSE(bg::length(linestring, strategy),
+                      bg::length(linestring), 0.0001);
+}
+
+template <typename Linestring>
+void test_linear(std::string const& wkt)
+{
+    Linestring linestring;
+    bg::read_wkt(wkt, linestring);
+    test_linear<false>(linestring);
+    test_linear<true>(linestring);
+}
+
+// Point-point distances are calculated as by pythagoras
+template <bool Compensated, typename P>
+void test_point_point(P const& p, P const& q)
+{
+    bg::strategy::distance::pythagoras_blocked<void, Compensated> strategy;
+    BOOST_CHECK_CLOSE(bg::distance(p, q, strategy),
+                      bg::distance(p, q), 0.0001);
+    BOOST_CHECK_CLOSE(bg::comparable_distance(p, q, strategy),
+                      bg::comparable_distance(p, q), 0.0001);
+}
+
+// Circle of many points, spanning several blocks
+template <typename Ring>
+Ring create_circle(std::size_t count)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+    typedef typename bg::coordinate_type<Ring>::type coordinate_type;
+
+    Ring ring;
+    double const two_pi = 2.0 * 3.14159265358979323846;
+    for (std::size_t i = 0; i <= count; i++)
+    {
+        double const angle = -two_pi * (i % count) / count;
+        bg::append(ring, point_type(
+                coordinate_type(1000.0 + 10.0 * std::cos(angle)),
+                coordinate_type(1000.0 + 10.0 * std::sin(angle))));
+    }
+    return ring;
+}
+
+// Ranges of 3D points are not processed in blocks, z is not ignored
+void test_3d()
+{
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point_type;
+    typedef bg::model::linestring<point_type> linestring;
+
+    linestring ls;
+    bg::read_wkt("LINESTRING(0 0 0,0 0 10,3 4 10)", ls);
+
+    BOOST_CHECK_CLOSE(bg::length(ls), 15.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::length(ls,
+        bg::strategy::distance::pythagoras_blocked<>()), 15.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::length(ls,
+        bg::strategy::distance::pythagoras_blocked<void, true>()), 15.0, 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, false> ccw_polygon;
+    typedef bg::model::polygon<P, true, false> open_polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::linestring<P> linestring;
+
+    test_areal<ring>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_areal<polygon>("POLYGON((0 0,0 7,4 2,2 0,0 0),(1 1,2 1,1 2,1 1))");
+    test_areal<ccw_polygon>("POLYGON((0 0,2 0,4 2,0 7,0 0),(1 1,1 2,2 1,1 1))");
+    test_areal<open_polygon>("POLYGON((0 0,0 7,4 2,2 0),(1 1,2 1,1 2))");
+
+    test_linear<linestring>("LINESTRING(0 0,3 4,3 8,6 12)");
+    test_linear<linestring>("LINESTRING(1 1,4 5)");
+
+    test_point_point<false>(P(1, 1), P(4, 5));
+    test_point_point<true>(P(1, 1), P(4, 5));
+
+    {
+        // Degenerate ranges have no area and no length
+        ring single;
+        bg::read_wkt("POLYGON((1 1))", single);
+        bg::strategy::area::surveyor_blocked<P> area_strategy;
+        bg::strategy::distance::pythagoras_blocked<> distance_strategy;
+        BOOST_CHECK_EQUAL(bg::area(single, area_strategy), 0);
+        BOOST_CHECK_EQUAL(bg::perimeter(single, distance_strategy), 0);
+
+        linestring empty;
+        BOOST_CHECK_EQUAL(bg::length(empty, distance_strategy), 0);
+    }
+
+    {
+        // 1000 segments: exactly 15 full blocks and a partial block
+        ring const circle = create_circle<ring>(1000);
+        test_areal<false>(circle);
+        test_areal<true>(circle);
+
+        // 64 segments: exactly one block
+        ring const block = create_circle<ring>(64);
+        test_areal<false>(block);
+        test_areal<true>(block);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    test_3d();
+
+    return 0;
+}
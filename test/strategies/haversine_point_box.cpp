@@ -0,0 +1,173 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2014 Barend Gehrels, Amsterdam, the Netherlands.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/strategies/spherical/distance_haversine.hpp>
+#include <boost/geometry/strategies/spherical/distance_haversine_point_box.hpp>
+
+
+double const average_earth_radius = 6372795.0;
+
+
+// Minimum distance to points sampled in the box, walking eastwards from its
+// minimal to its maximal longitude (also if it crosses the antimeridian)
+template <typename Point, typename Box>
+double sampled_distance(Point const& point, Box const& box)
+{
+    bg::strategy::distance::haversine<double> const haversine(average_earth_radius);
+
+    double const lon_min = bg::get<bg::min_corner, 0>(box);
+    double lon_max = bg::get<bg::max_corner, 0>(box);
+    if (lon_max < lon_min)
+    {
+        lon_max += 360.0;
+    }
+    double const lat_min = bg::get<bg::min_corner, 1>(box);
+    double const lat_max = bg::get<bg::max_corner, 1>(box);
+
+    int const steps = 400;
+    double result = -1;
+    for (int i = 0; i <= steps; i++)
+    {
+        double lon = lon_min + (lon_max - lon_min) * i / steps;
+        if (lon > 180.0)
+        {
+            lon -= 360.0;
+        }
+        for (int j = 0; j <= steps; j++)
+        {
+            double const lat = lat_min + (lat_max - lat_min) * j / steps;
+            double const d = haversine.apply(point, Point(lon, lat));
+            if (result < 0 || d < result)
+            {
+                result = d;
+            }
+        }
+    }
+    return result;
+}
+
+template <typename Point>
+void test_distance(double lon, double lat,
+        double lon_min, double lat_min, double lon_max, double lat_max)
+{
+    typedef bg::model::box<Point> box_type;
+
+    Point const point(lon, lat);
+    box_type const box(Point(lon_min, lat_min), Point(lon_max, lat_max));
+
+    bg::strategy::distance::haversine_point_box<double> const
+        strategy(average_earth_radius);
+
+    double const detected = strategy.apply(point, box);
+    double const sampled = sampled_distance(point, box);
+
+    // The distance is to the nearest point of the box, so it is not larger
+    // than the distance to any sampled point, and close to the nearest one
+    std::ostringstream out;
+    out << bg::wkt(point) << " " << bg::wkt(box)
+        << " detected: " << detected << " sampled: " << sampled;
+    BOOST_CHECK_MESSAGE(detected <= sampled + 1.0e-6, out.str());
+    BOOST_CHECK_MESSAGE(sampled - detected < 2000.0, out.str());
+
+    // The default strategy for spherical points and boxes, and its
+    // comparable distance, which is comparable with that of haversine
+    BOOST_CHECK_CLOSE(bg::distance(point, box) * average_earth_radius,
+                      detected, 0.0001);
+    double const comparable = bg::comparable_distance(point, box);
+    bg::strategy::distance::comparable::haversine<double> const comparable_haversine;
+    if (sampled == 0)
+    {
+        BOOST_CHECK_EQUAL(comparable, 0);
+    }
+    else
+    {
+        BOOST_CHECK(comparable <= comparable_haversine.apply(point,
+            Point(bg::get<bg::min_corner, 0>(box), bg::get<bg::min_corner, 1>(box))));
+    }
+}
+
+template <typename Point>
+void test_all()
+{
+    // Inside, above, below
+    test_distance<Point>(5, 52, 0, 50, 10, 55);
+    test_distance<Point>(5, 60, 0, 50, 10, 55);
+    test_distance<Point>(5, -10, 0, 50, 10, 55);
+
+    // West and east, the nearest point is on a meridian, not on a corner
+    test_distance<Point>(-10, 53, 0, 50, 10, 55);
+    test_distance<Point>(20, 53, 0, 50, 10, 55);
+    test_distance<Point>(20, 70, 0, 50, 10, 55);
+    test_distance<Point>(20, 20, 0, 50, 10, 55);
+
+    // Far away, more than 90 degrees in longitude
+    test_distance<Point>(130, 53, 0, 50, 10, 55);
+    test_distance<Point>(-160, -30, 0, -50, 10, 55);
+    test_distance<Point>(175, 0, 0, -50, 10, 55);
+
+    // Near the antimeridian, on both sides
+    test_distance<Point>(179.5, 10, -180, 0, -175, 20);
+    test_distance<Point>(-179.5, 10, 170, 0, 179, 20);
+
+    // Box crossing the antimeridian
+    test_distance<Point>(-179, 10, 170, 0, -170, 20);
+    test_distance<Point>(179, 30, 170, 0, -170, 20);
+    test_distance<Point>(-160, 10, 170, 0, -170, 20);
+    test_distance<Point>(160, 10, 170, 0, -170, 20);
+    test_distance<Point>(0, 10, 170, 0, -170, 20);
+
+    // Box around the globe, and a pole
+    test_distance<Point>(45, 10, -180, 20, 180, 30);
+    test_distance<Point>(45, 90, 0, 50, 10, 55);
+    test_distance<Point>(45, -90, 0, 50, 10, 55);
+}
+
+// Point-box distances in other coordinate systems than spherical
+// equatorial still use the cartesian strategy
+template <typename CoordinateSystem>
+void test_cartesian_fallback()
+{
+    typedef bg::model::point<double, 2, CoordinateSystem> point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> cartesian_point;
+    typedef bg::model::box<cartesian_point> cartesian_box;
+
+    point_type const point(1, 2);
+    box_type const box(point_type(4, 6), point_type(5, 7));
+
+    cartesian_point const cpoint(1, 2);
+    cartesian_box const cbox(cartesian_point(4, 6), cartesian_point(5, 7));
+
+    BOOST_CHECK_CLOSE(bg::distance(point, box), bg::distance(cpoint, cbox), 0.0001);
+    BOOST_CHECK_CLOSE(bg::distance(box, point), bg::distance(cpoint, cbox), 0.0001);
+    BOOST_CHECK_CLOSE(bg::comparable_distance(point, box),
+                      bg::comparable_distance(cpoint, cbox), 0.0001);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
+
+    test_cartesian_fallback<bg::cs::spherical<bg::degree> >();
+    test_cartesian_fallback<bg::cs::geographic<bg::degree> >();
+
+    return 0;
+}
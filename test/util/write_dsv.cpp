@@ -36,6 +36,10 @@ void test_dsv(std::string const& wkt, std::string const& dsv)
     std::ostringstream out;
     out << bg::dsv(geometry);
     BOOST_CHECK_EQUAL(out.str(), dsv);
+
+    std::string buffer;
+    bg::write_dsv(geometry, buffer);
+    BOOST_CHECK_EQUAL(buffer, dsv);
 }
 
 